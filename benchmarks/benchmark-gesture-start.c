@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+/* Reports how long it takes a folded album to start navigating to a page it
+ * has never shown, with and without prewarming that page while idle.
+ *
+ * bis_album_navigate() starts the same child transition a swipe starts once
+ * it's prepared, so the time spent in it plus the first frame of the
+ * transition is what a swipe has to wait for before anything moves. Every run
+ * uses a new album, so the page is always cold unless it was prewarmed.
+ */
+
+#include <bismuth.h>
+
+#define N_RUNS 10
+#define N_ROWS 200
+#define SETTLE_MS 500
+#define TIMEOUT_USEC (5 * G_USEC_PER_SEC)
+
+typedef struct {
+  gint64 frame_start;
+  gint64 frame_time;
+} FrameTiming;
+
+static GtkWidget *
+create_page (int index)
+{
+  GtkWidget *box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 6);
+  GtkWidget *scrolled = gtk_scrolled_window_new ();
+  int i;
+
+  for (i = 0; i < N_ROWS; i++) {
+    GtkWidget *row = gtk_box_new (GTK_ORIENTATION_HORIZONTAL, 12);
+    char *text = g_strdup_printf ("Page %d, row %d, with a bit of text to lay out",
+                                  index, i);
+    GtkWidget *label = gtk_label_new (text);
+
+    gtk_label_set_wrap (GTK_LABEL (label), TRUE);
+    gtk_widget_set_hexpand (label, TRUE);
+
+    gtk_box_append (GTK_BOX (row), gtk_image_new_from_icon_name ("folder-symbolic"));
+    gtk_box_append (GTK_BOX (row), label);
+    gtk_box_append (GTK_BOX (row), gtk_check_button_new ());
+    gtk_box_append (GTK_BOX (box), row);
+
+    g_free (text);
+  }
+
+  gtk_scrolled_window_set_child (GTK_SCROLLED_WINDOW (scrolled), box);
+
+  return scrolled;
+}
+
+static gboolean
+settled_cb (gboolean *settled)
+{
+  *settled = TRUE;
+
+  return G_SOURCE_REMOVE;
+}
+
+/* Runs the main loop for a while, so that the album is done folding and has
+ * had its idle time. */
+static void
+settle (void)
+{
+  gboolean settled = FALSE;
+
+  g_timeout_add (SETTLE_MS, (GSourceFunc) settled_cb, &settled);
+
+  while (!settled)
+    g_main_context_iteration (NULL, TRUE);
+}
+
+static void
+update_cb (GdkFrameClock *clock,
+           FrameTiming   *timing)
+{
+  if (!timing->frame_start)
+    timing->frame_start = g_get_monotonic_time ();
+}
+
+static void
+after_paint_cb (GdkFrameClock *clock,
+                FrameTiming   *timing)
+{
+  if (timing->frame_start && !timing->frame_time)
+    timing->frame_time = g_get_monotonic_time () - timing->frame_start;
+}
+
+/* Returns the time it took to start navigating, in microseconds */
+static gint64
+measure_gesture_start (guint prewarm_budget)
+{
+  GtkWidget *window = gtk_window_new ();
+  GtkWidget *album = bis_album_new ();
+  FrameTiming timing = { 0, 0 };
+  GdkFrameClock *clock;
+  gulong update_id, after_paint_id;
+  gint64 navigate_time, deadline;
+  int i;
+
+  bis_album_set_can_unfold (BIS_ALBUM (album), FALSE);
+  bis_album_set_can_navigate_back (BIS_ALBUM (album), TRUE);
+  bis_album_set_can_navigate_forward (BIS_ALBUM (album), TRUE);
+  bis_album_set_prewarm_budget (BIS_ALBUM (album), prewarm_budget);
+
+  for (i = 0; i < 3; i++)
+    bis_album_append (BIS_ALBUM (album), create_page (i));
+
+  gtk_window_set_default_size (GTK_WINDOW (window), 360, 640);
+  gtk_window_set_child (GTK_WINDOW (window), album);
+  gtk_window_present (GTK_WINDOW (window));
+
+  while (!gtk_widget_get_mapped (album))
+    g_main_context_iteration (NULL, TRUE);
+
+  settle ();
+
+  clock = gtk_widget_get_frame_clock (album);
+  update_id = g_signal_connect (clock, "update",
+                                G_CALLBACK (update_cb), &timing);
+  after_paint_id = g_signal_connect (clock, "after-paint",
+                                     G_CALLBACK (after_paint_cb), &timing);
+
+  navigate_time = g_get_monotonic_time ();
+  bis_album_navigate (BIS_ALBUM (album), BIS_NAVIGATION_DIRECTION_FORWARD);
+  navigate_time = g_get_monotonic_time () - navigate_time;
+
+  deadline = g_get_monotonic_time () + TIMEOUT_USEC;
+
+  while (!timing.frame_time && g_get_monotonic_time () < deadline)
+    g_main_context_iteration (NULL, TRUE);
+
+  g_signal_handler_disconnect (clock, update_id);
+  g_signal_handler_disconnect (clock, after_paint_id);
+
+  gtk_window_destroy (GTK_WINDOW (window));
+
+  if (!timing.frame_time)
+    g_error ("The transition never drew its first frame");
+
+  return navigate_time + timing.frame_time;
+}
+
+static void
+print_times (const char   *label,
+             const gint64 *times)
+{
+  gint64 total = 0, min = G_MAXINT64, max = 0;
+  int i;
+
+  for (i = 0; i < N_RUNS; i++) {
+    total += times[i];
+    min = MIN (min, times[i]);
+    max = MAX (max, times[i]);
+  }
+
+  g_print ("  %-24s mean %7.2f ms  min %7.2f ms  max %7.2f ms\n", label,
+           total / 1000.0 / N_RUNS, min / 1000.0, max / 1000.0);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gint64 cold[N_RUNS], prewarmed[N_RUNS];
+  guint default_budget;
+  GtkWidget *album;
+  int i;
+
+  bis_init ();
+
+  album = g_object_ref_sink (bis_album_new ());
+  default_budget = bis_album_get_prewarm_budget (BIS_ALBUM (album));
+  g_object_unref (album);
+
+  /* Alternate between the two, so that any drift affects both alike */
+  for (i = 0; i < N_RUNS; i++) {
+    cold[i] = measure_gesture_start (0);
+    prewarmed[i] = measure_gesture_start (default_budget);
+  }
+
+  g_print ("BisAlbum gesture start (%d runs, %d rows per page)\n",
+           N_RUNS, N_ROWS);
+  print_times ("without prewarm", cold);
+  g_print ("  %-24s %u ms\n", "prewarm budget", default_budget);
+  print_times ("with prewarm", prewarmed);
+
+  return 0;
+}
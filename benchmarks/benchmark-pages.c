@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+/* Reports the memory bismuth itself needs per page, apart from the page
+ * widgets, and the time it takes to tear a container down.
+ *
+ * The page widgets are created before they are added, so the memory they need
+ * is excluded from the per-page figure. The same goes for the container
+ * itself. Run with G_SLICE=always-malloc so that GLib allocations show up in
+ * the heap figure on older GLib versions.
+ */
+
+#include <bismuth.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#ifdef G_OS_UNIX
+#include <unistd.h>
+#endif
+
+#define N_PAGES 10000
+
+typedef struct {
+  gint64 rss;
+  gint64 heap;
+} MemoryUsage;
+
+typedef struct {
+  const char *name;
+  GtkWidget *(* create) (void);
+  void (* add) (GtkWidget *container,
+                GtkWidget *child);
+  GtkSelectionModel *(* get_pages) (GtkWidget *container);
+} ContainerInfo;
+
+static void
+get_memory_usage (MemoryUsage *usage)
+{
+  usage->rss = -1;
+  usage->heap = -1;
+
+#ifdef G_OS_UNIX
+  {
+    char *contents = NULL;
+
+    if (g_file_get_contents ("/proc/self/statm", &contents, NULL, NULL)) {
+      char **fields = g_strsplit (contents, " ", -1);
+
+      if (g_strv_length (fields) > 1)
+        usage->rss = g_ascii_strtoll (fields[1], NULL, 10) * sysconf (_SC_PAGESIZE);
+
+      g_strfreev (fields);
+      g_free (contents);
+    }
+  }
+#endif
+
+#ifdef __GLIBC__
+#if __GLIBC_PREREQ (2, 33)
+  usage->heap = mallinfo2 ().uordblks;
+#endif
+#endif
+}
+
+static void
+print_delta (const char        *label,
+             const MemoryUsage *before,
+             const MemoryUsage *after)
+{
+  if (before->rss >= 0 && after->rss >= 0)
+    g_print ("  %-24s rss %8.1f B/page", label,
+             (double) (after->rss - before->rss) / N_PAGES);
+  else
+    g_print ("  %-24s rss      n/a", label);
+
+  if (before->heap >= 0 && after->heap >= 0)
+    g_print ("  heap %8.1f B/page\n",
+             (double) (after->heap - before->heap) / N_PAGES);
+  else
+    g_print ("  heap      n/a\n");
+}
+
+static GtkWidget *
+create_page (void)
+{
+  return g_object_ref_sink (gtk_label_new ("Page"));
+}
+
+static GtkWidget *
+create_album (void)
+{
+  return bis_album_new ();
+}
+
+static void
+add_album_page (GtkWidget *container,
+                GtkWidget *child)
+{
+  bis_album_append (BIS_ALBUM (container), child);
+}
+
+static GtkSelectionModel *
+get_album_pages (GtkWidget *container)
+{
+  return bis_album_get_pages (BIS_ALBUM (container));
+}
+
+static GtkWidget *
+create_carousel (void)
+{
+  return bis_carousel_new ();
+}
+
+static void
+add_carousel_page (GtkWidget *container,
+                   GtkWidget *child)
+{
+  bis_carousel_append (BIS_CAROUSEL (container), child);
+}
+
+static GtkWidget *
+create_hugger (void)
+{
+  return bis_hugger_new ();
+}
+
+static void
+add_hugger_page (GtkWidget *container,
+                 GtkWidget *child)
+{
+  bis_hugger_add (BIS_HUGGER (container), child);
+}
+
+static GtkSelectionModel *
+get_hugger_pages (GtkWidget *container)
+{
+  return bis_hugger_get_pages (BIS_HUGGER (container));
+}
+
+static const ContainerInfo containers[] = {
+  { "BisAlbum", create_album, add_album_page, get_album_pages },
+  { "BisCarousel", create_carousel, add_carousel_page, NULL },
+  { "BisHugger", create_hugger, add_hugger_page, get_hugger_pages },
+};
+
+/* Tearing down the bare pages is part of tearing down every container, so
+ * measure it on its own to tell the two apart. */
+static void
+benchmark_bare_pages (void)
+{
+  GPtrArray *pages = g_ptr_array_new_with_free_func (g_object_unref);
+  gint64 start;
+  guint i;
+
+  for (i = 0; i < N_PAGES; i++)
+    g_ptr_array_add (pages, create_page ());
+
+  start = g_get_monotonic_time ();
+  g_ptr_array_unref (pages);
+
+  g_print ("bare pages\n");
+  g_print ("  %-24s %8.2f ms\n", "teardown",
+           (g_get_monotonic_time () - start) / 1000.0);
+}
+
+static void
+benchmark_container (const ContainerInfo *info)
+{
+  GPtrArray *pages = g_ptr_array_new_with_free_func (g_object_unref);
+  GtkSelectionModel *model = NULL;
+  MemoryUsage with_container, with_pages, with_model, added;
+  GtkWidget *container;
+  gint64 start;
+  guint i;
+
+  container = g_object_ref_sink (info->create ());
+
+  get_memory_usage (&with_container);
+
+  for (i = 0; i < N_PAGES; i++)
+    g_ptr_array_add (pages, create_page ());
+
+  get_memory_usage (&with_pages);
+
+  for (i = 0; i < N_PAGES; i++)
+    info->add (container, g_ptr_array_index (pages, i));
+
+  get_memory_usage (&added);
+
+  /* The pages model is only created on demand, but once it exists it is
+   * kept in sync with every page. */
+  if (info->get_pages) {
+    model = info->get_pages (container);
+
+    for (i = 0; i < N_PAGES; i++)
+      g_object_unref (g_list_model_get_item (G_LIST_MODEL (model), i));
+  }
+
+  get_memory_usage (&with_model);
+
+  /* Leave the container as the only owner of the pages */
+  g_ptr_array_unref (pages);
+
+  g_print ("%s (%d pages)\n", info->name, N_PAGES);
+  print_delta ("pages", &with_pages, &added);
+  if (model)
+    print_delta ("pages with model", &with_pages, &with_model);
+
+  start = g_get_monotonic_time ();
+  g_clear_object (&model);
+  g_object_unref (container);
+
+  g_print ("  %-24s %8.2f ms\n", "teardown",
+           (g_get_monotonic_time () - start) / 1000.0);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  guint i;
+
+  bis_init ();
+
+  benchmark_bare_pages ();
+
+  for (i = 0; i < G_N_ELEMENTS (containers); i++)
+    benchmark_container (&containers[i]);
+
+  return 0;
+}
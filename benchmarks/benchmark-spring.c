@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+/* Compares the accuracy and speed of BisSpringAnimation with and without
+ * BisSpringAnimation:precompute-trajectory.
+ *
+ * Both animations are evaluated directly through the calculate_value() vfunc,
+ * every millisecond of the estimated duration, so the figures don't depend on
+ * the frame clock. The errors are relative to the animated range. Sampling is
+ * the time prepare() takes to sample the trajectory when the animation starts
+ * playing, and the break-even point is how many evaluations it takes for the
+ * cheaper frames to make up for it.
+ */
+
+#include <bismuth.h>
+
+#include "bis-animation-private.h"
+
+#define N_PASSES 200
+#define N_SAMPLING_RUNS 200
+
+typedef struct {
+  const char *name;
+  double damping_ratio;
+  double mass;
+  double stiffness;
+  double initial_velocity;
+} SpringInfo;
+
+static const SpringInfo springs[] = {
+  { "underdamped", 0.5, 1, 500, 0 },
+  { "underdamped, flung", 0.5, 1, 500, 20 },
+  { "critically damped", 1, 1, 500, 0 },
+  { "overdamped", 1.5, 1, 500, 0 },
+};
+
+static void
+value_cb (double   value,
+          gpointer user_data)
+{
+}
+
+static BisAnimation *
+create_animation (GtkWidget        *widget,
+                  const SpringInfo *info,
+                  gboolean          precompute)
+{
+  BisAnimation *animation =
+    bis_spring_animation_new (widget, 0, 1,
+                              bis_spring_params_new (info->damping_ratio,
+                                                     info->mass,
+                                                     info->stiffness),
+                              bis_callback_animation_target_new (value_cb, NULL, NULL));
+
+  bis_spring_animation_set_initial_velocity (BIS_SPRING_ANIMATION (animation),
+                                             info->initial_velocity);
+  bis_spring_animation_set_precompute_trajectory (BIS_SPRING_ANIMATION (animation),
+                                                  precompute);
+
+  return animation;
+}
+
+static double
+calculate_value (BisAnimation *animation,
+                 guint         t)
+{
+  return BIS_ANIMATION_GET_CLASS (animation)->calculate_value (animation, t);
+}
+
+/* Returns the time per evaluation, in nanoseconds */
+static double
+measure_evaluation (BisAnimation *animation,
+                    guint         duration)
+{
+  volatile double sink = 0;
+  gint64 start;
+  guint i, t;
+
+  start = g_get_monotonic_time ();
+
+  for (i = 0; i < N_PASSES; i++)
+    for (t = 0; t < duration; t++)
+      sink += calculate_value (animation, t);
+
+  return (g_get_monotonic_time () - start) * 1000.0 / ((double) N_PASSES * duration);
+}
+
+/* Returns the time it takes to sample the trajectory, in nanoseconds */
+static double
+measure_sampling (BisAnimation *animation)
+{
+  BisSpringAnimation *spring = BIS_SPRING_ANIMATION (animation);
+  gint64 total = 0;
+  guint i;
+
+  for (i = 0; i < N_SAMPLING_RUNS; i++) {
+    gint64 start;
+
+    /* Turning it off discards the samples */
+    bis_spring_animation_set_precompute_trajectory (spring, FALSE);
+    bis_spring_animation_set_precompute_trajectory (spring, TRUE);
+
+    start = g_get_monotonic_time ();
+    BIS_ANIMATION_GET_CLASS (animation)->prepare (animation);
+    total += g_get_monotonic_time () - start;
+  }
+
+  return total * 1000.0 / N_SAMPLING_RUNS;
+}
+
+static void
+benchmark_spring (GtkWidget        *widget,
+                  const SpringInfo *info)
+{
+  BisAnimation *analytic = create_animation (widget, info, FALSE);
+  BisAnimation *sampled = create_animation (widget, info, TRUE);
+  guint duration = bis_spring_animation_get_estimated_duration (BIS_SPRING_ANIMATION (analytic));
+  double max_error = 0, total_error = 0, max_velocity_error = 0;
+  double analytic_ns, sampled_ns, sampling_ns;
+  guint t;
+
+  if (duration == BIS_DURATION_INFINITE) {
+    g_print ("%s: infinite duration, skipped\n", info->name);
+    g_object_unref (analytic);
+    g_object_unref (sampled);
+
+    return;
+  }
+
+  BIS_ANIMATION_GET_CLASS (sampled)->prepare (sampled);
+
+  for (t = 0; t < duration; t++) {
+    double error = ABS (calculate_value (analytic, t) - calculate_value (sampled, t));
+    double velocity_error = ABS (bis_spring_animation_get_velocity (BIS_SPRING_ANIMATION (analytic)) -
+                                 bis_spring_animation_get_velocity (BIS_SPRING_ANIMATION (sampled)));
+
+    max_error = MAX (max_error, error);
+    total_error += error;
+    max_velocity_error = MAX (max_velocity_error, velocity_error);
+  }
+
+  analytic_ns = measure_evaluation (analytic, duration);
+  sampled_ns = measure_evaluation (sampled, duration);
+  sampling_ns = measure_sampling (sampled);
+
+  g_print ("%s (estimated duration %u ms)\n", info->name, duration);
+  g_print ("  %-24s max %.2e  mean %.2e\n", "value error",
+           max_error, total_error / duration);
+  g_print ("  %-24s max %.2e /s\n", "velocity error", max_velocity_error);
+  g_print ("  %-24s %8.1f ns/eval\n", "analytic", analytic_ns);
+  g_print ("  %-24s %8.1f ns/eval\n", "sampled", sampled_ns);
+  g_print ("  %-24s %8.2f us", "sampling", sampling_ns / 1000);
+
+  if (analytic_ns > sampled_ns)
+    g_print (", breaks even after %.0f evaluations\n",
+             sampling_ns / (analytic_ns - sampled_ns));
+  else
+    g_print (", never breaks even\n");
+
+  g_object_unref (analytic);
+  g_object_unref (sampled);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  GtkWidget *widget;
+  guint i;
+
+  bis_init ();
+
+  widget = g_object_ref_sink (gtk_label_new (NULL));
+
+  for (i = 0; i < G_N_ELEMENTS (springs); i++)
+    benchmark_spring (widget, &springs[i]);
+
+  g_object_unref (widget);
+
+  return 0;
+}
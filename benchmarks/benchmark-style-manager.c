@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+/* Reports how long it takes BisStyleManager to switch between dark and light
+ * on a window with about 2000 widgets, and how many updates a burst of system
+ * color scheme changes results in.
+ *
+ * The latency is measured from setting the color scheme until the first frame
+ * drawn with the new style. The frame time is the part of it spent in that
+ * frame, from its update phase until it has been painted.
+ */
+
+#include <bismuth.h>
+
+#include "bis-settings-private.h"
+
+#define N_ROWS 500
+#define N_TOGGLES 20
+#define N_BURST_CHANGES 5
+#define N_SETTLE_FRAMES 5
+#define TIMEOUT_USEC (5 * G_USEC_PER_SEC)
+
+static const char light_css[] =
+  "window { background: #fafafa; color: #2e3436; }"
+  "label { color: #2e3436; }"
+  "button { background: #e8e8e7; color: #2e3436; border-radius: 6px; }";
+
+static const char dark_css[] =
+  "window { background: #242424; color: #eeeeec; }"
+  "label { color: #eeeeec; }"
+  "button { background: #3a3a3a; color: #eeeeec; border-radius: 6px; }";
+
+typedef struct {
+  guint n_notifies;
+  gboolean applied;
+  gint64 frame_start;
+  gint64 frame_time;
+  gint64 painted_time;
+} ToggleState;
+
+static GtkCssProvider *
+create_provider (const char *css)
+{
+  GtkCssProvider *provider = gtk_css_provider_new ();
+
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+  gtk_css_provider_load_from_data (provider, css, -1);
+G_GNUC_END_IGNORE_DEPRECATIONS
+
+  return provider;
+}
+
+static guint
+count_widgets (GtkWidget *widget)
+{
+  GtkWidget *child;
+  guint n = 1;
+
+  for (child = gtk_widget_get_first_child (widget);
+       child;
+       child = gtk_widget_get_next_sibling (child))
+    n += count_widgets (child);
+
+  return n;
+}
+
+static GtkWidget *
+create_window (void)
+{
+  GtkWidget *window = gtk_window_new ();
+  GtkWidget *scrolled = gtk_scrolled_window_new ();
+  GtkWidget *box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 6);
+  int i;
+
+  for (i = 0; i < N_ROWS; i++) {
+    GtkWidget *row = gtk_box_new (GTK_ORIENTATION_HORIZONTAL, 6);
+    char *text = g_strdup_printf ("Row %d", i);
+    GtkWidget *label = gtk_label_new (text);
+
+    gtk_widget_set_hexpand (label, TRUE);
+
+    gtk_box_append (GTK_BOX (row), label);
+    gtk_box_append (GTK_BOX (row), gtk_button_new_with_label ("Button"));
+    gtk_box_append (GTK_BOX (box), row);
+
+    g_free (text);
+  }
+
+  gtk_scrolled_window_set_child (GTK_SCROLLED_WINDOW (scrolled), box);
+  gtk_window_set_child (GTK_WINDOW (window), scrolled);
+  gtk_window_set_default_size (GTK_WINDOW (window), 600, 800);
+
+  return window;
+}
+
+static void
+notify_dark_cb (BisStyleManager *manager,
+                GParamSpec      *pspec,
+                ToggleState     *state)
+{
+  state->n_notifies++;
+  state->applied = TRUE;
+}
+
+static void
+update_cb (GdkFrameClock *clock,
+           ToggleState   *state)
+{
+  state->frame_start = g_get_monotonic_time ();
+}
+
+static void
+after_paint_cb (GdkFrameClock *clock,
+                ToggleState   *state)
+{
+  if (!state->applied || state->painted_time)
+    return;
+
+  state->painted_time = g_get_monotonic_time ();
+  state->frame_time = state->painted_time - state->frame_start;
+}
+
+static void
+wait_for_painted (GtkWidget   *window,
+                  ToggleState *state)
+{
+  gint64 deadline = g_get_monotonic_time () + TIMEOUT_USEC;
+
+  while (!state->painted_time && g_get_monotonic_time () < deadline)
+    g_main_context_iteration (NULL, TRUE);
+
+  if (!state->painted_time)
+    g_error ("The style change was never painted");
+}
+
+static void
+wait_for_frames (GtkWidget *widget,
+                 guint      n_frames)
+{
+  GdkFrameClock *clock = gtk_widget_get_frame_clock (widget);
+  gint64 target = gdk_frame_clock_get_frame_counter (clock) + n_frames;
+
+  while (gdk_frame_clock_get_frame_counter (clock) < target) {
+    gtk_widget_queue_draw (widget);
+    g_main_context_iteration (NULL, TRUE);
+  }
+}
+
+static void
+reset_state (ToggleState *state)
+{
+  state->n_notifies = 0;
+  state->applied = FALSE;
+  state->frame_start = 0;
+  state->frame_time = 0;
+  state->painted_time = 0;
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  BisStyleManager *manager;
+  BisSettings *settings;
+  GtkCssProvider *light, *dark;
+  ToggleState state = { 0 };
+  GtkWidget *window;
+  GdkFrameClock *clock;
+  gint64 total_latency = 0, max_latency = 0;
+  gint64 total_frame = 0, max_frame = 0;
+  gulong notify_id, update_id, after_paint_id;
+  int i;
+
+  bis_init ();
+
+  manager = bis_style_manager_get_default ();
+  light = create_provider (light_css);
+  dark = create_provider (dark_css);
+
+  bis_style_manager_set_css_provider (manager, BIS_STYLE_VARIANT_LIGHT, light);
+  bis_style_manager_set_css_provider (manager, BIS_STYLE_VARIANT_DARK, dark);
+  bis_style_manager_set_color_scheme (manager, BIS_COLOR_SCHEME_FORCE_LIGHT);
+
+  window = create_window ();
+  gtk_window_present (GTK_WINDOW (window));
+
+  while (!gtk_widget_get_mapped (window))
+    g_main_context_iteration (NULL, TRUE);
+
+  clock = gtk_widget_get_frame_clock (window);
+
+  /* Let the light style apply and the window settle */
+  wait_for_frames (window, N_SETTLE_FRAMES);
+
+  notify_id = g_signal_connect (manager, "notify::dark",
+                                G_CALLBACK (notify_dark_cb), &state);
+  update_id = g_signal_connect (clock, "update",
+                                G_CALLBACK (update_cb), &state);
+  after_paint_id = g_signal_connect (clock, "after-paint",
+                                     G_CALLBACK (after_paint_cb), &state);
+
+  for (i = 0; i < N_TOGGLES; i++) {
+    gint64 start, latency;
+
+    reset_state (&state);
+
+    start = g_get_monotonic_time ();
+    bis_style_manager_set_color_scheme (manager,
+                                        i % 2 ? BIS_COLOR_SCHEME_FORCE_LIGHT :
+                                                BIS_COLOR_SCHEME_FORCE_DARK);
+    wait_for_painted (window, &state);
+
+    latency = state.painted_time - start;
+    total_latency += latency;
+    max_latency = MAX (max_latency, latency);
+    total_frame += state.frame_time;
+    max_frame = MAX (max_frame, state.frame_time);
+  }
+
+  g_print ("BisStyleManager dark toggle (%u widgets, %d toggles)\n",
+           count_widgets (window), N_TOGGLES);
+  g_print ("  %-24s mean %7.2f ms  max %7.2f ms\n", "latency",
+           total_latency / 1000.0 / N_TOGGLES, max_latency / 1000.0);
+  g_print ("  %-24s mean %7.2f ms  max %7.2f ms\n", "frame",
+           total_frame / 1000.0 / N_TOGGLES, max_frame / 1000.0);
+
+  /* Change the system color scheme several times, letting the main loop run
+   * in between as it would for separate D-Bus signals. They should all be
+   * applied in the next frame, together. */
+  settings = bis_settings_get_default ();
+  bis_settings_start_override (settings);
+  bis_settings_override_system_supports_color_schemes (settings, TRUE);
+  bis_settings_override_color_scheme (settings, BIS_SYSTEM_COLOR_SCHEME_PREFER_LIGHT);
+  bis_style_manager_set_color_scheme (manager, BIS_COLOR_SCHEME_DEFAULT);
+  wait_for_frames (window, N_SETTLE_FRAMES);
+
+  reset_state (&state);
+
+  for (i = 0; i < N_BURST_CHANGES; i++) {
+    bis_settings_override_color_scheme (settings,
+                                        i % 2 ? BIS_SYSTEM_COLOR_SCHEME_PREFER_LIGHT :
+                                                BIS_SYSTEM_COLOR_SCHEME_PREFER_DARK);
+    g_main_context_iteration (NULL, FALSE);
+  }
+
+  wait_for_painted (window, &state);
+
+  g_print ("  %-24s %d changes, %u updates\n", "burst",
+           N_BURST_CHANGES, state.n_notifies);
+
+  bis_settings_end_override (settings);
+
+  g_signal_handler_disconnect (manager, notify_id);
+  g_signal_handler_disconnect (clock, update_id);
+  g_signal_handler_disconnect (clock, after_paint_id);
+
+  gtk_window_destroy (GTK_WINDOW (window));
+  g_object_unref (light);
+  g_object_unref (dark);
+
+  return 0;
+}
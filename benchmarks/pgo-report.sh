@@ -0,0 +1,40 @@
+#!/bin/sh
+#
+# Builds libbismuth with and without profile-guided optimization and prints
+# the benchmark results of both builds.
+#
+# The optimized build is trained with the test suite and the benchmarks, which
+# exercise size allocation, snapshotting, animations and page management.
+# Both need a display to run.
+#
+# Usage: benchmarks/pgo-report.sh [BUILD_DIR_PREFIX]
+
+set -e
+
+srcdir=$(cd "$(dirname "$0")/.." && pwd)
+prefix=${1:-_pgo}
+before="$prefix-before"
+after="$prefix-after"
+
+run_benchmarks () {
+  meson test -C "$1" --benchmark --verbose --num-processes 1
+}
+
+meson setup "$before" "$srcdir" -Dbuildtype=release
+meson compile -C "$before"
+run_benchmarks "$before" > "$before/benchmarks.txt"
+
+meson setup "$after" "$srcdir" -Dbuildtype=release -Db_pgo=generate
+meson compile -C "$after"
+# Failing budgets don't make the profile any less useful
+meson test -C "$after" || true
+run_benchmarks "$after" > /dev/null || true
+meson configure "$after" -Db_pgo=use -Db_lto=true
+meson compile -C "$after"
+run_benchmarks "$after" > "$after/benchmarks.txt"
+
+echo "== Without profile-guided optimization"
+cat "$before/benchmarks.txt"
+echo
+echo "== With profile-guided optimization and LTO"
+cat "$after/benchmarks.txt"
@@ -10,6 +10,7 @@
 #include "bis-animation-util.h"
 #include "bis-enums-private.h"
 #include "bis-fold-threshold-policy.h"
+#include "bis-loadable-private.h"
 #include "bis-macros-private.h"
 #include "bis-album.h"
 #include "bis-shadow-helper-private.h"
@@ -48,6 +49,10 @@
  * current child away, navigating to an upper child requires dragging it from
  * the edge where it resides. This doesn't affect non-dragging swipes.
  *
+ * Children implementing [iface@Loadable] start loading their content when
+ * they are shown, or when they become the visible child, including at the start
+ * of a swipe. Their loading is cancelled once they are hidden again.
+ *
  * ## CSS nodes
  *
  * `BisAlbum` has a single CSS node with name `album`. The node will get the
@@ -90,6 +95,7 @@ enum {
   PROP_CHILD_TRANSITION_RUNNING,
   PROP_CAN_NAVIGATE_BACK,
   PROP_CAN_NAVIGATE_FORWARD,
+  PROP_PREWARM_BUDGET,
   PROP_PAGES,
 
   /* orientable */
@@ -187,6 +193,10 @@ struct _BisAlbum {
   BisShadowHelper *shadow_helper;
   gboolean can_unfold;
 
+  guint prewarm_budget;
+  guint prewarm_idle_id;
+  int prewarm_step;
+
   GtkSelectionModel *pages;
 };
 
@@ -629,6 +639,72 @@ child_transition_cb (double      value,
     gtk_widget_queue_allocate (GTK_WIDGET (self));
 }
 
+/* Lays out the pages a swipe would reveal while the main loop is otherwise
+ * idle. They are hidden while folded, so otherwise the first frame of the
+ * swipe has to allocate them and compute their styles and text layouts from
+ * scratch. Pages are prepared whole, so the budget is checked between them.
+ * Stops once it has used it up and resumes on the next idle.
+ */
+static gboolean
+prewarm_cb (BisAlbum *self)
+{
+  gint64 start_time = g_get_monotonic_time ();
+  int width = gtk_widget_get_width (GTK_WIDGET (self));
+  int height = gtk_widget_get_height (GTK_WIDGET (self));
+
+  /* A swipe sets is_gesture_active and starts the transition as soon as it's
+   * prepared, so this also covers the whole gesture. */
+  if (!self->folded ||
+      self->mode_transition.current_pos > 0 ||
+      self->child_transition.transition_running ||
+      self->child_transition.is_gesture_active) {
+    self->prewarm_idle_id = 0;
+
+    return G_SOURCE_REMOVE;
+  }
+
+  while (self->prewarm_step < 2) {
+    BisNavigationDirection direction;
+    BisAlbumPage *page;
+    gboolean can_navigate;
+
+    if (self->prewarm_step++ == 0) {
+      direction = BIS_NAVIGATION_DIRECTION_BACK;
+      can_navigate = self->child_transition.can_navigate_back;
+    } else {
+      direction = BIS_NAVIGATION_DIRECTION_FORWARD;
+      can_navigate = self->child_transition.can_navigate_forward;
+    }
+
+    if (!can_navigate)
+      continue;
+
+    page = find_swipeable_page (self, direction);
+
+    if (page && page->navigatable && page->widget)
+      bis_widget_prewarm_child (GTK_WIDGET (self), page->widget, width, height);
+
+    if (g_get_monotonic_time () - start_time >= self->prewarm_budget * G_TIME_SPAN_MILLISECOND)
+      return G_SOURCE_CONTINUE;
+  }
+
+  self->prewarm_idle_id = 0;
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+queue_prewarm (BisAlbum *self)
+{
+  self->prewarm_step = 0;
+
+  if (self->prewarm_idle_id || !self->folded || !self->prewarm_budget)
+    return;
+
+  self->prewarm_idle_id =
+    g_idle_add_full (G_PRIORITY_LOW, (GSourceFunc) prewarm_cb, self, NULL);
+}
+
 static void
 child_transition_done_cb (BisAlbum *self)
 {
@@ -661,6 +737,8 @@ child_transition_done_cb (BisAlbum *self)
   set_child_transition_running (self, FALSE);
 
   self->child_transition.swipe_direction = 0;
+
+  queue_prewarm (self);
 }
 
 static void
@@ -749,6 +827,8 @@ set_visible_child (BisAlbum     *self,
   self->visible_child = page;
 
   if (page) {
+    /* Don't wait for the transition to allocate the page */
+    bis_loadable_start_load (page->widget);
     gtk_widget_set_child_visible (page->widget, TRUE);
 
     if (contains_focus) {
@@ -831,6 +911,11 @@ mode_transition_cb (double      value,
     gtk_widget_queue_allocate (GTK_WIDGET (self));
   else
     gtk_widget_queue_resize (GTK_WIDGET (self));
+
+  /* The hidden pages are only allocated at the album's size once it's done
+   * folding */
+  if (value <= 0)
+    queue_prewarm (self);
 }
 
 static void
@@ -1609,6 +1694,8 @@ album_remove (BisAlbum *self,
   if (self->last_visible_child == page)
     self->last_visible_child = NULL;
 
+  bis_loadable_cancel_load (child);
+
   gtk_widget_unparent (child);
 
   g_object_unref (page);
@@ -1899,14 +1986,19 @@ bis_album_size_allocate (GtkWidget *widget,
   else
     bis_album_size_allocate_unfolded (self, width, height);
 
-  /* Apply visibility and allocation. */
+  /* Apply visibility and allocation. Pages are only loaded while they are
+   * shown, which is every page when unfolded. */
   for (children = directed_children; children; children = children->next) {
     BisAlbumPage *page = children->data;
 
     gtk_widget_set_child_visible (page->widget, page->visible);
 
-    if (!page->visible)
+    if (!page->visible) {
+      bis_loadable_cancel_load (page->widget);
       continue;
+    }
+
+    bis_loadable_start_load (page->widget);
 
     gtk_widget_size_allocate (page->widget, &page->alloc, baseline);
 
@@ -2068,6 +2160,9 @@ bis_album_get_property (GObject    *object,
   case PROP_CAN_NAVIGATE_FORWARD:
     g_value_set_boolean (value, bis_album_get_can_navigate_forward (self));
     break;
+  case PROP_PREWARM_BUDGET:
+    g_value_set_uint (value, bis_album_get_prewarm_budget (self));
+    break;
   case PROP_PAGES:
     g_value_take_object (value, bis_album_get_pages (self));
     break;
@@ -2118,6 +2213,9 @@ bis_album_set_property (GObject      *object,
   case PROP_CAN_NAVIGATE_FORWARD:
     bis_album_set_can_navigate_forward (self, g_value_get_boolean (value));
     break;
+  case PROP_PREWARM_BUDGET:
+    bis_album_set_prewarm_budget (self, g_value_get_uint (value));
+    break;
   case PROP_ORIENTATION:
     set_orientation (self, g_value_get_enum (value));
     break;
@@ -2143,6 +2241,7 @@ bis_album_dispose (GObject *object)
 
   g_clear_object (&self->mode_transition.animation);
   g_clear_object (&self->child_transition.animation);
+  g_clear_handle_id (&self->prewarm_idle_id, g_source_remove);
 
   G_OBJECT_CLASS (bis_album_parent_class)->dispose (object);
 }
@@ -2391,6 +2490,27 @@ bis_album_class_init (BisAlbumClass *klass)
                           FALSE,
                           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * BisAlbum:prewarm-budget: (attributes org.gtk.Property.get=bis_album_get_prewarm_budget org.gtk.Property.set=bis_album_set_prewarm_budget)
+   *
+   * How long the album may spend preparing hidden pages per idle, in
+   * milliseconds.
+   *
+   * While folded, the album lays out the pages a swipe would reveal when the
+   * main loop is idle, so that the swipe doesn't have to do it in its first
+   * frame. The pages stay hidden and are not mapped or drawn. Set to 0 to
+   * disable this.
+   *
+   * The budget is only checked between pages, so laying out a single large
+   * page can take longer than it.
+   *
+   * Since: 1.0
+   */
+  props[PROP_PREWARM_BUDGET] =
+    g_param_spec_uint ("prewarm-budget", NULL, NULL,
+                       0, G_MAXUINT, 4,
+                       G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * BisAlbum:pages: (attributes org.gtk.Property.get=bis_album_get_pages)
    *
@@ -2456,6 +2576,7 @@ bis_album_init (BisAlbum *self)
   self->mode_transition.duration = 250;
   self->mode_transition.current_pos = 1.0;
   self->can_unfold = TRUE;
+  self->prewarm_budget = 4;
 
   controller = GTK_EVENT_CONTROLLER (gtk_gesture_click_new ());
   gtk_gesture_single_set_button (GTK_GESTURE_SINGLE (controller), 0);
@@ -3597,6 +3718,60 @@ bis_album_set_can_navigate_forward (BisAlbum *self,
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_CAN_NAVIGATE_FORWARD]);
 }
 
+/**
+ * bis_album_get_prewarm_budget: (attributes org.gtk.Method.get_property=prewarm-budget)
+ * @self: a album
+ *
+ * Gets how long @self may spend preparing hidden pages per idle.
+ *
+ * Returns: the prewarm budget, in milliseconds
+ *
+ * Since: 1.0
+ */
+guint
+bis_album_get_prewarm_budget (BisAlbum *self)
+{
+  g_return_val_if_fail (BIS_IS_ALBUM (self), 0);
+
+  return self->prewarm_budget;
+}
+
+/**
+ * bis_album_set_prewarm_budget: (attributes org.gtk.Method.set_property=prewarm-budget)
+ * @self: a album
+ * @budget: the new budget, in milliseconds
+ *
+ * Sets how long @self may spend preparing hidden pages per idle.
+ *
+ * While folded, the album lays out the pages a swipe would reveal when the
+ * main loop is idle, so that the swipe doesn't have to do it in its first
+ * frame. The pages stay hidden and are not mapped or drawn. Set to 0 to
+ * disable this.
+ *
+ * The budget is only checked between pages, so laying out a single large
+ * page can take longer than it.
+ *
+ * Since: 1.0
+ */
+void
+bis_album_set_prewarm_budget (BisAlbum *self,
+                              guint     budget)
+{
+  g_return_if_fail (BIS_IS_ALBUM (self));
+
+  if (self->prewarm_budget == budget)
+    return;
+
+  self->prewarm_budget = budget;
+
+  if (budget)
+    queue_prewarm (self);
+  else
+    g_clear_handle_id (&self->prewarm_idle_id, g_source_remove);
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_PREWARM_BUDGET]);
+}
+
 /**
  * bis_album_get_adjacent_child:
  * @self: a album
@@ -144,6 +144,12 @@ BIS_AVAILABLE_IN_ALL
 void     bis_album_set_can_navigate_forward (BisAlbum *self,
                                                gboolean    can_navigate_forward);
 
+BIS_AVAILABLE_IN_ALL
+guint bis_album_get_prewarm_budget (BisAlbum *self);
+BIS_AVAILABLE_IN_ALL
+void  bis_album_set_prewarm_budget (BisAlbum *self,
+                                    guint     budget);
+
 BIS_AVAILABLE_IN_ALL
 GtkWidget *bis_album_get_adjacent_child (BisAlbum             *self,
                                            BisNavigationDirection  direction);
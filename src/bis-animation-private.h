@@ -23,6 +23,10 @@ struct _BisAnimationClass
 
   double (*calculate_value) (BisAnimation *self,
                              guint         t);
+
+  /* Called when the animation starts or resumes playing, before its first
+   * frame. Optional. */
+  void (*prepare) (BisAnimation *self);
 };
 
 G_END_DECLS
@@ -233,6 +233,9 @@ play (BisAnimation *self)
     return;
   }
 
+  if (BIS_ANIMATION_GET_CLASS (self)->prepare)
+    BIS_ANIMATION_GET_CLASS (self)->prepare (self);
+
   priv->start_time += gdk_frame_clock_get_frame_time (gtk_widget_get_frame_clock (priv->widget)) / 1000;
   priv->start_time -= priv->paused_time;
 
@@ -118,10 +118,9 @@ snapshot_dots (GtkWidget      *widget,
   current_position = 0;
   remaining_progress = 1;
 
-  graphene_rect_init (&rect, -DOTS_RADIUS, -DOTS_RADIUS, DOTS_RADIUS * 2, DOTS_RADIUS * 2);
-
   for (i = 0; i < n_pages; i++) {
     double progress, radius, opacity;
+    GdkRGBA dot_color;
     GskRoundedRect clip;
 
     if (orientation == GTK_ORIENTATION_HORIZONTAL)
@@ -137,21 +136,23 @@ snapshot_dots (GtkWidget      *widget,
     radius = bis_lerp (DOTS_RADIUS, DOTS_RADIUS_SELECTED, progress) * sizes[i];
     opacity = bis_lerp (DOTS_OPACITY, DOTS_OPACITY_SELECTED, progress) * sizes[i];
 
-    gsk_rounded_rect_init_from_rect (&clip, &rect, radius);
-
-    gtk_snapshot_save (snapshot);
-    gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (x, y));
-    gtk_snapshot_scale (snapshot, radius / DOTS_RADIUS, radius / DOTS_RADIUS);
-
-    gtk_snapshot_push_rounded_clip (snapshot, &clip);
-    gtk_snapshot_push_opacity (snapshot, opacity);
-
-    gtk_snapshot_append_color (snapshot, &color, &rect);
-
-    gtk_snapshot_pop (snapshot);
-    gtk_snapshot_pop (snapshot);
-
-    gtk_snapshot_restore (snapshot);
+    /* Draw each dot as a single rounded clip over a color node, with the
+     * opacity folded into the color, instead of pushing a transform and an
+     * opacity node per page. The corner radius matches the one the scaled
+     * clip used to have, so dots that are being added or removed still
+     * shrink into rounded squares rather than circles. */
+    if (radius > 0 && opacity > 0) {
+      graphene_rect_init (&rect, x - radius, y - radius, radius * 2, radius * 2);
+      gsk_rounded_rect_init_from_rect (&clip, &rect,
+                                       MIN (radius, radius * radius / DOTS_RADIUS));
+
+      dot_color = color;
+      dot_color.alpha *= opacity;
+
+      gtk_snapshot_push_rounded_clip (snapshot, &clip);
+      gtk_snapshot_append_color (snapshot, &dot_color, &rect);
+      gtk_snapshot_pop (snapshot);
+    }
 
     if (orientation == GTK_ORIENTATION_HORIZONTAL)
       x += dot_size * sizes[i] / 2.0;
@@ -9,10 +9,11 @@
 #include "bis-carousel.h"
 
 #include "bis-animation-util.h"
+#include "bis-loadable-private.h"
 #include "bis-macros-private.h"
 #include "bis-navigation-direction.h"
 #include "bis-spring-animation.h"
-#include "bis-swipe-tracker.h"
+#include "bis-swipe-tracker-private.h"
 #include "bis-swipeable.h"
 #include "bis-timed-animation.h"
 #include "bis-widget-utils-private.h"
@@ -37,6 +38,10 @@
  * [class@CarouselIndicatorDots] and [class@CarouselIndicatorLines] can be used
  * to provide page indicators for `BisCarousel`.
  *
+ * Pages implementing [iface@Loadable] start loading their content when they
+ * are shown, or when the carousel starts scrolling or swiping towards them.
+ * Their loading is cancelled once the carousel settles with them off screen.
+ *
  * ## CSS nodes
  *
  * `BisCarousel` has a single CSS node with name `carousel`.
@@ -73,6 +78,7 @@ struct _BisCarousel
   ChildInfo *animation_target_child;
 
   BisSwipeTracker *tracker;
+  gboolean swipe_active;
 
   gboolean allow_scroll_wheel;
 
@@ -375,6 +381,38 @@ scroll_animation_done_cb (BisCarousel *self)
   g_signal_emit (self, signals[SIGNAL_PAGE_CHANGED], 0, index);
 }
 
+/* Starts loading the pages that are shown or scrolled to. Other pages are
+ * cancelled only once the carousel has settled, so that the neighbor page
+ * started when preparing a swipe keeps loading until the swipe ends.
+ */
+static void
+update_page_loading (BisCarousel *self)
+{
+  gboolean settled;
+  GList *l;
+
+  /* The tracker can drop a prepared swipe without emitting end-swipe, for
+   * example when it's disabled or the carousel is unrealized */
+  if (self->swipe_active && !bis_swipe_tracker_is_swiping (self->tracker))
+    self->swipe_active = FALSE;
+
+  settled = !self->swipe_active &&
+            bis_animation_get_state (self->animation) != BIS_ANIMATION_PLAYING;
+
+  for (l = self->children; l; l = l->next) {
+    ChildInfo *child = l->data;
+
+    if (child->removing)
+      continue;
+
+    if (child == self->animation_target_child ||
+        (child->visible && gtk_widget_get_visible (child->widget)))
+      bis_loadable_start_load (child->widget);
+    else if (settled)
+      bis_loadable_cancel_load (child->widget);
+  }
+}
+
 static void
 scroll_to (BisCarousel *self,
            GtkWidget   *widget,
@@ -385,6 +423,8 @@ scroll_to (BisCarousel *self,
   if (self->animation_target_child == NULL)
     return;
 
+  update_page_loading (self);
+
   self->animation_source_position = self->position;
 
   bis_spring_animation_set_value_from (BIS_SPRING_ANIMATION (self->animation),
@@ -408,6 +448,32 @@ get_closest_snap_point (BisCarousel *self)
   return closest_child->snap_point;
 }
 
+static void
+prepare_cb (BisSwipeTracker        *tracker,
+            BisNavigationDirection  direction,
+            BisCarousel            *self)
+{
+  ChildInfo *current = get_closest_child_at (self, self->position, TRUE, FALSE);
+  GList *l;
+
+  self->swipe_active = TRUE;
+
+  if (!current)
+    return;
+
+  l = g_list_find (self->children, current);
+
+  do {
+    if (direction == BIS_NAVIGATION_DIRECTION_BACK)
+      l = l->prev;
+    else
+      l = l->next;
+  } while (l && ((ChildInfo *) l->data)->removing);
+
+  if (l)
+    bis_loadable_start_load (((ChildInfo *) l->data)->widget);
+}
+
 static void
 begin_swipe_cb (BisSwipeTracker *tracker,
                 BisCarousel     *self)
@@ -431,6 +497,8 @@ end_swipe_cb (BisSwipeTracker *tracker,
 {
   GtkWidget *child = get_page_at_position (self, to);
 
+  self->swipe_active = FALSE;
+
   scroll_to (self, child, velocity);
 }
 
@@ -708,6 +776,8 @@ bis_carousel_size_allocate (GtkWidget *widget,
     else
       x += self->distance * child_info->size;
   }
+
+  update_page_loading (self);
 }
 
 static void
@@ -1066,6 +1136,7 @@ bis_carousel_init (BisCarousel *self)
   self->tracker = bis_swipe_tracker_new (BIS_SWIPEABLE (self));
   bis_swipe_tracker_set_allow_mouse_drag (self->tracker, TRUE);
 
+  g_signal_connect_object (self->tracker, "prepare", G_CALLBACK (prepare_cb), self, 0);
   g_signal_connect_object (self->tracker, "begin-swipe", G_CALLBACK (begin_swipe_cb), self, 0);
   g_signal_connect_object (self->tracker, "update-swipe", G_CALLBACK (update_swipe_cb), self, 0);
   g_signal_connect_object (self->tracker, "end-swipe", G_CALLBACK (end_swipe_cb), self, 0);
@@ -1384,6 +1455,8 @@ bis_carousel_remove (BisCarousel *self,
 
   info->removing = TRUE;
 
+  bis_loadable_cancel_load (child);
+
   gtk_widget_unparent (child);
 
   info->widget = NULL;
@@ -1538,6 +1611,10 @@ bis_carousel_set_interactive (BisCarousel *self,
 
   bis_swipe_tracker_set_enabled (self->tracker, interactive);
 
+  /* Disabling the tracker drops a swipe that hasn't started moving */
+  if (!interactive && self->swipe_active)
+    update_page_loading (self);
+
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_INTERACTIVE]);
 }
 
@@ -793,6 +793,53 @@ bis_hugger_snapshot (GtkWidget   *widget,
   }
 }
 
+static void
+allocate_page (BisHugger     *self,
+               BisHuggerPage *page,
+               int            width,
+               int            height,
+               int            known_min)
+{
+  GtkAllocation child_allocation;
+  int min;
+
+  child_allocation.x = 0;
+  child_allocation.y = 0;
+
+  /* known_min is the minimum size of the page along the hugger's
+   * orientation when it has already been measured, or -1 otherwise.
+   */
+  if (self->orientation == GTK_ORIENTATION_HORIZONTAL) {
+    if (known_min < 0)
+      gtk_widget_measure (page->widget, GTK_ORIENTATION_HORIZONTAL,
+                          -1, &known_min, NULL, NULL, NULL);
+    child_allocation.width = MAX (known_min, width);
+    gtk_widget_measure (page->widget, GTK_ORIENTATION_VERTICAL,
+                        child_allocation.width, &min, NULL, NULL, NULL);
+    child_allocation.height = MAX (min, height);
+  } else {
+    if (known_min < 0)
+      gtk_widget_measure (page->widget, GTK_ORIENTATION_VERTICAL,
+                          -1, &known_min, NULL, NULL, NULL);
+    child_allocation.height = MAX (known_min, height);
+    gtk_widget_measure (page->widget, GTK_ORIENTATION_HORIZONTAL,
+                        child_allocation.height, &min, NULL, NULL, NULL);
+    child_allocation.width = MAX (min, width);
+  }
+
+  if (child_allocation.width > width) {
+    if (gtk_widget_get_direction (GTK_WIDGET (self)) == GTK_TEXT_DIR_RTL)
+      child_allocation.x = (width - child_allocation.width) * (1 - self->xalign);
+    else
+      child_allocation.x = (width - child_allocation.width) * self->xalign;
+  }
+
+  if (child_allocation.height > height)
+    child_allocation.y = (height - child_allocation.height) * self->yalign;
+
+  gtk_widget_size_allocate (page->widget, &child_allocation, -1);
+}
+
 static void
 bis_hugger_size_allocate (GtkWidget *widget,
                             int        width,
@@ -800,9 +847,9 @@ bis_hugger_size_allocate (GtkWidget *widget,
                             int        baseline)
 {
   BisHugger *self = BIS_HUGGER (widget);
-  BisHuggerPage *page = NULL;
+  BisHuggerPage *page = NULL, *measured_page = NULL;
   GList *l;
-  GtkAllocation child_allocation;
+  int page_min = -1;
 
   for (l = self->children; l; l = l->next) {
     GtkWidget *child = NULL;
@@ -826,6 +873,9 @@ bis_hugger_size_allocate (GtkWidget *widget,
     gtk_widget_measure (child, self->orientation, -1,
                         &child_min, &child_nat, NULL, NULL);
 
+    measured_page = page;
+    page_min = child_min;
+
     if (child_min <= compare_size && self->switch_threshold_policy == BIS_FOLD_THRESHOLD_POLICY_MINIMUM)
       break;
 
@@ -840,77 +890,13 @@ bis_hugger_size_allocate (GtkWidget *widget,
                      self->transition_type,
                      self->transition_duration);
 
-  child_allocation.x = 0;
-  child_allocation.y = 0;
-
-  if (self->last_visible_child) {
-    int min;
-
-    if (self->orientation == GTK_ORIENTATION_HORIZONTAL) {
-      gtk_widget_measure (self->last_visible_child->widget, GTK_ORIENTATION_HORIZONTAL,
-                          -1, &min, NULL, NULL, NULL);
-      child_allocation.width = MAX (min, width);
-      gtk_widget_measure (self->last_visible_child->widget, GTK_ORIENTATION_VERTICAL,
-                          child_allocation.width, &min, NULL, NULL, NULL);
-      child_allocation.height = MAX (min, height);
-    } else {
-      gtk_widget_measure (self->last_visible_child->widget, GTK_ORIENTATION_VERTICAL,
-                          -1, &min, NULL, NULL, NULL);
-      child_allocation.height = MAX (min, height);
-      gtk_widget_measure (self->last_visible_child->widget, GTK_ORIENTATION_HORIZONTAL,
-                          child_allocation.height, &min, NULL, NULL, NULL);
-      child_allocation.width = MAX (min, width);
-    }
-
-    if (child_allocation.width > width) {
-      if (gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL)
-        child_allocation.x = (width - child_allocation.width) * (1 - self->xalign);
-      else
-        child_allocation.x = (width - child_allocation.width) * self->xalign;
-    }
-
-    if (child_allocation.height > height)
-      child_allocation.y = (height - child_allocation.height) * self->yalign;
-
-    gtk_widget_size_allocate (self->last_visible_child->widget, &child_allocation, -1);
-  }
-
-  child_allocation.width = width;
-  child_allocation.height = height;
-  child_allocation.x = 0;
-  child_allocation.y = 0;
-
-  if (self->visible_child) {
-    int min;
-
-    if (self->orientation == GTK_ORIENTATION_HORIZONTAL) {
-      gtk_widget_measure (self->visible_child->widget, GTK_ORIENTATION_HORIZONTAL,
-                          -1, &min, NULL, NULL, NULL);
-      child_allocation.width = MAX (min, width);
-      gtk_widget_measure (self->visible_child->widget, GTK_ORIENTATION_VERTICAL,
-                          child_allocation.width, &min, NULL, NULL, NULL);
-      child_allocation.height = MAX (min, height);
-    } else {
-      gtk_widget_measure (self->visible_child->widget, GTK_ORIENTATION_VERTICAL,
-                          -1, &min, NULL, NULL, NULL);
-      child_allocation.height = MAX (min, height);
-      gtk_widget_measure (self->visible_child->widget, GTK_ORIENTATION_HORIZONTAL,
-                          child_allocation.height, &min, NULL, NULL, NULL);
-      child_allocation.width = MAX (min, width);
-    }
-
-    if (child_allocation.width > width) {
-      if (gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL)
-        child_allocation.x = (width - child_allocation.width) * (1 - self->xalign);
-      else
-        child_allocation.x = (width - child_allocation.width) * self->xalign;
-    }
-
-    if (child_allocation.height > height)
-      child_allocation.y = (height - child_allocation.height) * self->yalign;
+  if (self->last_visible_child)
+    allocate_page (self, self->last_visible_child, width, height,
+                   self->last_visible_child == measured_page ? page_min : -1);
 
-    gtk_widget_size_allocate (self->visible_child->widget, &child_allocation, -1);
-  }
+  if (self->visible_child)
+    allocate_page (self, self->visible_child, width, height,
+                   self->visible_child == measured_page ? page_min : -1);
 }
 
 static void
@@ -621,8 +621,7 @@ compute_sizes (BisLapel  *self,
     if (lapel_expand) {
       *lapel_size = total;
     } else {
-      get_preferred_size (self->lapel.widget, self->orientation, NULL, lapel_size);
-      *lapel_size = MIN (*lapel_size, total);
+      *lapel_size = MIN (lapel_nat, total);
     }
 
     return;
@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#pragma once
+
+#if !defined(_BISMUTH_INSIDE) && !defined(BISMUTH_COMPILATION)
+#error "Only <bismuth.h> can be included directly."
+#endif
+
+#include "bis-loadable.h"
+
+G_BEGIN_DECLS
+
+void bis_loadable_start_load  (GtkWidget *widget);
+void bis_loadable_cancel_load (GtkWidget *widget);
+
+G_END_DECLS
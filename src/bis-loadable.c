@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#include "config.h"
+
+#include "bis-loadable-private.h"
+
+/**
+ * BisLoadable:
+ *
+ * An interface for pages that prepare their content asynchronously.
+ *
+ * Pages whose content is expensive to prepare, for example because it needs
+ * to parse data files, decode images or build large models, can implement
+ * `BisLoadable` to avoid blocking the main thread when they are navigated to.
+ *
+ * Such a page should display a lightweight placeholder until it is loaded.
+ * [vfunc@Loadable.load_async] should run the preparation on a worker thread,
+ * for example with [method@Gio.Task.run_in_thread], and swap the real content
+ * in once the task completes on the main thread.
+ *
+ * [class@Album] and [class@Carousel] start loading their `BisLoadable` pages
+ * when they are shown, or as soon as navigation towards them starts, so that
+ * the content can be prepared while the transition is running. They cancel the
+ * load via the passed [class@Gio.Cancellable] if the page is hidden again
+ * before it finishes, in which case a later load is started the next time it's
+ * shown. Failed loads are retried the same way.
+ *
+ * Since: 1.0
+ */
+
+typedef struct {
+  GCancellable *cancellable;
+  gboolean loaded;
+  gboolean failed;
+} LoadState;
+
+typedef struct {
+  BisLoadable *self;
+  GCancellable *cancellable;
+} LoadData;
+
+static GQuark load_state_quark;
+
+G_DEFINE_INTERFACE (BisLoadable, bis_loadable, GTK_TYPE_WIDGET)
+
+static void
+bis_loadable_default_init (BisLoadableInterface *iface)
+{
+  load_state_quark = g_quark_from_static_string ("bis-loadable-state");
+}
+
+static void
+load_state_free (LoadState *state)
+{
+  if (state->cancellable) {
+    g_cancellable_cancel (state->cancellable);
+    g_object_unref (state->cancellable);
+  }
+
+  g_free (state);
+}
+
+static LoadState *
+get_load_state (BisLoadable *self,
+                gboolean     create)
+{
+  LoadState *state = g_object_get_qdata (G_OBJECT (self), load_state_quark);
+
+  if (!state && create) {
+    state = g_new0 (LoadState, 1);
+    g_object_set_qdata_full (G_OBJECT (self), load_state_quark, state,
+                             (GDestroyNotify) load_state_free);
+  }
+
+  return state;
+}
+
+/**
+ * bis_loadable_load_async: (virtual load_async)
+ * @self: a loadable
+ * @cancellable: (nullable): a cancellable
+ * @callback: (scope async): a callback to call when the content is ready
+ * @user_data: the data to pass to @callback
+ *
+ * Starts preparing the content of @self.
+ *
+ * Containers call this automatically when navigating towards @self, there is
+ * usually no need to call it manually.
+ *
+ * Since: 1.0
+ */
+void
+bis_loadable_load_async (BisLoadable         *self,
+                         GCancellable        *cancellable,
+                         GAsyncReadyCallback  callback,
+                         gpointer             user_data)
+{
+  BisLoadableInterface *iface;
+
+  g_return_if_fail (BIS_IS_LOADABLE (self));
+  g_return_if_fail (cancellable == NULL || G_IS_CANCELLABLE (cancellable));
+
+  iface = BIS_LOADABLE_GET_IFACE (self);
+  g_return_if_fail (iface->load_async != NULL);
+
+  iface->load_async (self, cancellable, callback, user_data);
+}
+
+/**
+ * bis_loadable_load_finish: (virtual load_finish)
+ * @self: a loadable
+ * @result: a `GAsyncResult`
+ * @error: return location for an error
+ *
+ * Finishes an operation started with [method@Loadable.load_async].
+ *
+ * Returns: whether the content was loaded
+ *
+ * Since: 1.0
+ */
+gboolean
+bis_loadable_load_finish (BisLoadable   *self,
+                          GAsyncResult  *result,
+                          GError       **error)
+{
+  BisLoadableInterface *iface;
+
+  g_return_val_if_fail (BIS_IS_LOADABLE (self), FALSE);
+  g_return_val_if_fail (G_IS_ASYNC_RESULT (result), FALSE);
+
+  iface = BIS_LOADABLE_GET_IFACE (self);
+  g_return_val_if_fail (iface->load_finish != NULL, FALSE);
+
+  return iface->load_finish (self, result, error);
+}
+
+/**
+ * bis_loadable_get_loaded:
+ * @self: a loadable
+ *
+ * Gets whether a container has finished loading the content of @self.
+ *
+ * Returns: whether the content of @self is loaded
+ *
+ * Since: 1.0
+ */
+gboolean
+bis_loadable_get_loaded (BisLoadable *self)
+{
+  LoadState *state;
+
+  g_return_val_if_fail (BIS_IS_LOADABLE (self), FALSE);
+
+  state = get_load_state (self, FALSE);
+
+  return state && state->loaded;
+}
+
+/* The source object of @result is up to the implementation, so the loadable
+ * is passed along in @data instead. */
+static void
+load_cb (GObject      *source_object,
+         GAsyncResult *result,
+         LoadData     *data)
+{
+  BisLoadable *self = data->self;
+  LoadState *state = get_load_state (self, FALSE);
+  g_autoptr (GError) error = NULL;
+  gboolean loaded;
+
+  loaded = bis_loadable_load_finish (self, result, &error);
+
+  if (error && !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+    g_warning ("Failed to load %s %p: %s",
+               G_OBJECT_TYPE_NAME (self), self, error->message);
+
+  /* A newer load may have been started after this one was cancelled */
+  if (state && state->cancellable == data->cancellable) {
+    g_clear_object (&state->cancellable);
+    state->loaded = loaded;
+    state->failed = !loaded;
+  }
+
+  g_object_unref (data->cancellable);
+  g_object_unref (data->self);
+  g_free (data);
+}
+
+void
+bis_loadable_start_load (GtkWidget *widget)
+{
+  LoadState *state;
+  LoadData *data;
+
+  if (!widget || !BIS_IS_LOADABLE (widget))
+    return;
+
+  state = get_load_state (BIS_LOADABLE (widget), TRUE);
+
+  /* Failed loads are only retried after the page has been hidden, otherwise
+   * containers would restart them on every allocation. */
+  if (state->loaded || state->failed || state->cancellable)
+    return;
+
+  data = g_new0 (LoadData, 1);
+  data->self = g_object_ref (BIS_LOADABLE (widget));
+  data->cancellable = g_cancellable_new ();
+
+  state->cancellable = g_object_ref (data->cancellable);
+
+  bis_loadable_load_async (data->self, data->cancellable,
+                           (GAsyncReadyCallback) load_cb, data);
+}
+
+void
+bis_loadable_cancel_load (GtkWidget *widget)
+{
+  LoadState *state;
+
+  if (!widget || !BIS_IS_LOADABLE (widget))
+    return;
+
+  state = get_load_state (BIS_LOADABLE (widget), FALSE);
+
+  if (!state)
+    return;
+
+  state->failed = FALSE;
+
+  if (!state->cancellable)
+    return;
+
+  g_cancellable_cancel (state->cancellable);
+  g_clear_object (&state->cancellable);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#pragma once
+
+#if !defined(_BISMUTH_INSIDE) && !defined(BISMUTH_COMPILATION)
+#error "Only <bismuth.h> can be included directly."
+#endif
+
+#include "bis-version.h"
+
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+#define BIS_TYPE_LOADABLE (bis_loadable_get_type ())
+
+BIS_AVAILABLE_IN_ALL
+G_DECLARE_INTERFACE (BisLoadable, bis_loadable, BIS, LOADABLE, GtkWidget)
+
+/**
+ * BisLoadableInterface:
+ * @parent: The parent interface.
+ * @load_async: Starts preparing the page content.
+ * @load_finish: Finishes preparing the page content.
+ *
+ * An interface for pages that load their content asynchronously.
+ *
+ * Since: 1.0
+ **/
+struct _BisLoadableInterface
+{
+  GTypeInterface parent;
+
+  void     (*load_async)  (BisLoadable         *self,
+                           GCancellable        *cancellable,
+                           GAsyncReadyCallback  callback,
+                           gpointer             user_data);
+  gboolean (*load_finish) (BisLoadable         *self,
+                           GAsyncResult        *result,
+                           GError             **error);
+
+  /*< private >*/
+  gpointer padding[4];
+};
+
+BIS_AVAILABLE_IN_ALL
+void     bis_loadable_load_async  (BisLoadable         *self,
+                                   GCancellable        *cancellable,
+                                   GAsyncReadyCallback  callback,
+                                   gpointer             user_data);
+BIS_AVAILABLE_IN_ALL
+gboolean bis_loadable_load_finish (BisLoadable         *self,
+                                   GAsyncResult        *result,
+                                   GError             **error);
+
+BIS_AVAILABLE_IN_ALL
+gboolean bis_loadable_get_loaded (BisLoadable *self);
+
+G_END_DECLS
@@ -15,6 +15,9 @@
 #define DELTA 0.001
 #define MAX_ITERATIONS 20000
 
+#define TRAJECTORY_SAMPLE_INTERVAL 4 /* ms */
+#define TRAJECTORY_MAX_SAMPLES 4096
+
 /**
  * BisSpringAnimation:
  *
@@ -50,6 +53,11 @@
  * If the initial and final values are equal, and the initial velocity is not 0,
  * the animation value will bounce and return to its resting position.
  *
+ * On low-end devices running many spring animations at once, evaluating the
+ * spring equation on every frame can be noticeable. Setting
+ * [property@SpringAnimation:precompute-trajectory] samples the trajectory once
+ * instead, and interpolates between the samples on each frame.
+ *
  * Since: 1.0
  */
 
@@ -68,6 +76,11 @@ struct _BisSpringAnimation
   gboolean latch;
 
   guint estimated_duration; /*ms*/
+
+  gboolean precompute_trajectory;
+  /* Pairs of (displacement from value_to, velocity), one per sample interval */
+  float *trajectory;
+  guint n_samples;
 };
 
 struct _BisSpringAnimationClass
@@ -87,6 +100,7 @@ enum {
   PROP_CLAMP,
   PROP_ESTIMATED_DURATION,
   PROP_VELOCITY,
+  PROP_PRECOMPUTE_TRAJECTORY,
   LAST_PROP,
 };
 
@@ -232,9 +246,62 @@ calculate_duration (BisSpringAnimation *self)
   return x1 * 1000;
 }
 
+static void
+invalidate_trajectory (BisSpringAnimation *self)
+{
+  g_clear_pointer (&self->trajectory, g_free);
+  self->n_samples = 0;
+}
+
+static gboolean
+ensure_trajectory (BisSpringAnimation *self)
+{
+  guint i;
+
+  if (self->trajectory)
+    return TRUE;
+
+  if (self->estimated_duration == BIS_DURATION_INFINITE ||
+      self->estimated_duration / TRAJECTORY_SAMPLE_INTERVAL + 2 > TRAJECTORY_MAX_SAMPLES)
+    return FALSE;
+
+  /* One extra sample past the end so that every frame before the estimated
+   * duration has a sample on both sides to interpolate between. */
+  self->n_samples = self->estimated_duration / TRAJECTORY_SAMPLE_INTERVAL + 2;
+  self->trajectory = g_new (float, self->n_samples * 2);
+
+  for (i = 0; i < self->n_samples; i++) {
+    double velocity;
+    double value = oscillate (self, i * TRAJECTORY_SAMPLE_INTERVAL, &velocity);
+
+    self->trajectory[i * 2] = value - self->value_to;
+    self->trajectory[i * 2 + 1] = velocity;
+  }
+
+  return TRUE;
+}
+
+static double
+sample_trajectory (BisSpringAnimation *self,
+                   guint               t,
+                   double             *velocity)
+{
+  guint i = t / TRAJECTORY_SAMPLE_INTERVAL;
+  double progress = (double) (t % TRAJECTORY_SAMPLE_INTERVAL) / TRAJECTORY_SAMPLE_INTERVAL;
+  float *sample = &self->trajectory[i * 2];
+
+  g_assert (i + 1 < self->n_samples);
+
+  *velocity = bis_lerp (sample[1], sample[3], progress);
+
+  return self->value_to + bis_lerp (sample[0], sample[2], progress);
+}
+
 static void
 estimate_duration (BisSpringAnimation *self)
 {
+  invalidate_trajectory (self);
+
   /* This function can be called during construction */
   if (!self->spring_params)
     return;
@@ -266,12 +333,29 @@ bis_spring_animation_calculate_value (BisAnimation *animation,
     return self->value_to;
   }
 
-  value = oscillate (self, t, &self->velocity);
+  /* The trajectory is normally sampled in prepare(), but a parameter may have
+   * changed while playing */
+  if (self->precompute_trajectory && ensure_trajectory (self))
+    value = sample_trajectory (self, t, &self->velocity);
+  else
+    value = oscillate (self, t, &self->velocity);
+
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_VELOCITY]);
 
   return value;
 }
 
+static void
+bis_spring_animation_prepare (BisAnimation *animation)
+{
+  BisSpringAnimation *self = BIS_SPRING_ANIMATION (animation);
+
+  /* Sample before the tick callback is added, so that the first frame only
+   * has to interpolate like every other frame */
+  if (self->precompute_trajectory)
+    ensure_trajectory (self);
+}
+
 static void
 bis_spring_animation_constructed (GObject *object)
 {
@@ -288,6 +372,7 @@ bis_spring_animation_dispose (GObject *object)
   BisSpringAnimation *self = BIS_SPRING_ANIMATION (object);
 
   g_clear_pointer (&self->spring_params, bis_spring_params_unref);
+  invalidate_trajectory (self);
 
   G_OBJECT_CLASS (bis_spring_animation_parent_class)->dispose (object);
 }
@@ -333,6 +418,10 @@ bis_spring_animation_get_property (GObject    *object,
     g_value_set_double (value, bis_spring_animation_get_velocity (self));
     break;
 
+  case PROP_PRECOMPUTE_TRAJECTORY:
+    g_value_set_boolean (value, bis_spring_animation_get_precompute_trajectory (self));
+    break;
+
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -371,6 +460,10 @@ bis_spring_animation_set_property (GObject      *object,
     bis_spring_animation_set_latch (self, g_value_get_boolean (value));
     break;
 
+  case PROP_PRECOMPUTE_TRAJECTORY:
+    bis_spring_animation_set_precompute_trajectory (self, g_value_get_boolean (value));
+    break;
+
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -389,6 +482,7 @@ bis_spring_animation_class_init (BisSpringAnimationClass *klass)
 
   animation_class->estimate_duration = bis_spring_animation_estimate_duration;
   animation_class->calculate_value = bis_spring_animation_calculate_value;
+  animation_class->prepare = bis_spring_animation_prepare;
 
   /**
    * BisSpringAnimation:value-from: (attributes org.gtk.Property.get=bis_spring_animation_get_value_from org.gtk.Property.set=bis_spring_animation_set_value_from)
@@ -525,6 +619,31 @@ bis_spring_animation_class_init (BisSpringAnimationClass *klass)
                          0,
                          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
 
+  /**
+   * BisSpringAnimation:precompute-trajectory: (attributes org.gtk.Property.get=bis_spring_animation_get_precompute_trajectory org.gtk.Property.set=bis_spring_animation_set_precompute_trajectory)
+   *
+   * Whether to precompute the trajectory of the spring.
+   *
+   * If set to `TRUE`, the trajectory is sampled every 4 milliseconds when the
+   * animation starts playing, and the value and velocity on each frame are
+   * linearly interpolated between the samples instead of being calculated from
+   * the spring equation.
+   *
+   * This trades a small amount of accuracy and memory for cheaper frames. The
+   * samples are discarded whenever any parameter of the animation changes. If
+   * that happens while it's playing, the trajectory is sampled again on the
+   * next frame.
+   *
+   * Animations with an infinite or very long estimated duration always use the
+   * spring equation.
+   *
+   * Since: 1.0
+   */
+  props[PROP_PRECOMPUTE_TRAJECTORY] =
+    g_param_spec_boolean ("precompute-trajectory", NULL, NULL,
+                          FALSE,
+                          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, props);
 }
 
@@ -901,3 +1020,52 @@ bis_spring_animation_get_velocity (BisSpringAnimation *self)
 
   return self->velocity;
 }
+
+/**
+ * bis_spring_animation_get_precompute_trajectory: (attributes org.gtk.Method.get_property=precompute-trajectory)
+ * @self: a spring animation
+ *
+ * Gets whether @self precomputes its trajectory.
+ *
+ * Returns: whether the trajectory is precomputed
+ *
+ * Since: 1.0
+ */
+gboolean
+bis_spring_animation_get_precompute_trajectory (BisSpringAnimation *self)
+{
+  g_return_val_if_fail (BIS_IS_SPRING_ANIMATION (self), FALSE);
+
+  return self->precompute_trajectory;
+}
+
+/**
+ * bis_spring_animation_set_precompute_trajectory: (attributes org.gtk.Method.set_property=precompute-trajectory)
+ * @self: a spring animation
+ * @precompute_trajectory: whether to precompute the trajectory
+ *
+ * Sets whether @self precomputes its trajectory.
+ *
+ * If set to `TRUE`, the trajectory is sampled once when the animation starts,
+ * and interpolated on each frame instead of evaluating the spring equation.
+ *
+ * Since: 1.0
+ */
+void
+bis_spring_animation_set_precompute_trajectory (BisSpringAnimation *self,
+                                                gboolean            precompute_trajectory)
+{
+  g_return_if_fail (BIS_IS_SPRING_ANIMATION (self));
+
+  precompute_trajectory = !!precompute_trajectory;
+
+  if (self->precompute_trajectory == precompute_trajectory)
+    return;
+
+  self->precompute_trajectory = precompute_trajectory;
+
+  if (!precompute_trajectory)
+    invalidate_trajectory (self);
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_PRECOMPUTE_TRAJECTORY]);
+}
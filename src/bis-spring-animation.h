@@ -73,4 +73,10 @@ guint bis_spring_animation_get_estimated_duration (BisSpringAnimation *self);
 BIS_AVAILABLE_IN_ALL
 double bis_spring_animation_get_velocity (BisSpringAnimation *self);
 
+BIS_AVAILABLE_IN_ALL
+gboolean bis_spring_animation_get_precompute_trajectory (BisSpringAnimation *self);
+BIS_AVAILABLE_IN_ALL
+void     bis_spring_animation_set_precompute_trajectory (BisSpringAnimation *self,
+                                                         gboolean            precompute_trajectory);
+
 G_END_DECLS
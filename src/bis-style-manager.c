@@ -0,0 +1,634 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#include "config.h"
+
+#include "bis-style-manager.h"
+
+#include "bis-macros-private.h"
+#include "bis-settings-private.h"
+
+#define N_STYLE_VARIANTS (BIS_STYLE_VARIANT_HIGH_CONTRAST_DARK + 1)
+
+/* Changes of the system preferences are applied in the update phase of the
+ * next frame of the mapped windows, so that all the ones that come in before
+ * it are coalesced. Windows that are mapped but don't draw, such as minimized
+ * ones, are only waited for UPDATE_TIMEOUT_DURATION ms. With no window mapped,
+ * updates are applied in an idle after pending D-Bus and input events have
+ * been dispatched instead. Changes made by the application are applied right
+ * away.
+ */
+#define UPDATE_PRIORITY (GDK_PRIORITY_REDRAW - 10)
+#define UPDATE_TIMEOUT_DURATION 100
+
+/**
+ * BisColorScheme:
+ * @BIS_COLOR_SCHEME_DEFAULT: Same as `BIS_COLOR_SCHEME_PREFER_LIGHT`.
+ * @BIS_COLOR_SCHEME_FORCE_LIGHT: Always use the light variant.
+ * @BIS_COLOR_SCHEME_PREFER_LIGHT: Use the light variant unless the system
+ *   prefers dark appearance.
+ * @BIS_COLOR_SCHEME_PREFER_DARK: Use the dark variant unless the system
+ *   prefers light appearance.
+ * @BIS_COLOR_SCHEME_FORCE_DARK: Always use the dark variant.
+ *
+ * Application color schemes for [property@StyleManager:color-scheme].
+ *
+ * Since: 1.0
+ */
+
+/**
+ * BisStyleVariant:
+ * @BIS_STYLE_VARIANT_LIGHT: The light variant.
+ * @BIS_STYLE_VARIANT_DARK: The dark variant.
+ * @BIS_STYLE_VARIANT_HIGH_CONTRAST: The light high contrast variant.
+ * @BIS_STYLE_VARIANT_HIGH_CONTRAST_DARK: The dark high contrast variant.
+ *
+ * Style variants a [class@StyleManager] can switch between.
+ *
+ * Since: 1.0
+ */
+
+/**
+ * BisStyleManager:
+ *
+ * A class for managing application-wide styling.
+ *
+ * `BisStyleManager` follows the system color scheme and high contrast
+ * preferences, combines them with the application's
+ * [property@StyleManager:color-scheme] and switches between CSS providers
+ * set with [method@StyleManager.set_css_provider].
+ *
+ * The providers are expected to be loaded once, up front. Switching variants
+ * only swaps the active provider for the default display. Changes of the
+ * system preferences made before the next frame are applied in a single update
+ * at its start, so they notify [property@StyleManager:dark] and
+ * [property@StyleManager:high-contrast] at most once per frame. Setting
+ * [property@StyleManager:color-scheme] is applied right away. The providers
+ * follow the default display if it changes, so the style manager can be
+ * created before it's opened.
+ *
+ * If no provider is set for a high contrast variant, the provider for the
+ * regular variant with the same brightness is used instead.
+ *
+ * Since: 1.0
+ */
+
+struct _BisStyleManager
+{
+  GObject parent_instance;
+
+  GdkDisplay *display;
+  BisSettings *settings;
+
+  BisColorScheme color_scheme;
+  gboolean dark;
+  gboolean high_contrast;
+
+  GtkCssProvider *providers[N_STYLE_VARIANTS];
+  GtkCssProvider *applied_provider;
+
+  GPtrArray *update_clocks;
+  guint update_source_id;
+};
+
+G_DEFINE_FINAL_TYPE (BisStyleManager, bis_style_manager, G_TYPE_OBJECT);
+
+enum {
+  PROP_0,
+  PROP_COLOR_SCHEME,
+  PROP_SYSTEM_SUPPORTS_COLOR_SCHEMES,
+  PROP_DARK,
+  PROP_HIGH_CONTRAST,
+  LAST_PROP,
+};
+
+static GParamSpec *props[LAST_PROP];
+
+static BisStyleManager *default_instance;
+
+static gboolean
+compute_dark (BisStyleManager *self)
+{
+  BisSystemColorScheme system_scheme = bis_settings_get_color_scheme (self->settings);
+
+  switch (self->color_scheme) {
+  case BIS_COLOR_SCHEME_FORCE_LIGHT:
+    return FALSE;
+  case BIS_COLOR_SCHEME_DEFAULT:
+  case BIS_COLOR_SCHEME_PREFER_LIGHT:
+    return system_scheme == BIS_SYSTEM_COLOR_SCHEME_PREFER_DARK;
+  case BIS_COLOR_SCHEME_PREFER_DARK:
+    return system_scheme != BIS_SYSTEM_COLOR_SCHEME_PREFER_LIGHT;
+  case BIS_COLOR_SCHEME_FORCE_DARK:
+    return TRUE;
+  default:
+    g_assert_not_reached ();
+  }
+}
+
+static GtkCssProvider *
+get_current_provider (BisStyleManager *self)
+{
+  BisStyleVariant variant;
+
+  if (self->high_contrast) {
+    variant = self->dark ? BIS_STYLE_VARIANT_HIGH_CONTRAST_DARK : BIS_STYLE_VARIANT_HIGH_CONTRAST;
+
+    if (self->providers[variant])
+      return self->providers[variant];
+  }
+
+  variant = self->dark ? BIS_STYLE_VARIANT_DARK : BIS_STYLE_VARIANT_LIGHT;
+
+  return self->providers[variant];
+}
+
+static void
+update_provider (BisStyleManager *self)
+{
+  GtkCssProvider *provider = get_current_provider (self);
+  GdkDisplay *display = gdk_display_get_default ();
+
+  if (provider == self->applied_provider && display == self->display)
+    return;
+
+  if (self->display && self->applied_provider)
+    gtk_style_context_remove_provider_for_display (self->display,
+                                                   GTK_STYLE_PROVIDER (self->applied_provider));
+
+  g_set_object (&self->applied_provider, provider);
+  g_set_object (&self->display, display);
+
+  if (self->display && self->applied_provider)
+    gtk_style_context_add_provider_for_display (self->display,
+                                                GTK_STYLE_PROVIDER (self->applied_provider),
+                                                GTK_STYLE_PROVIDER_PRIORITY_APPLICATION);
+}
+
+static void
+update_style (BisStyleManager *self)
+{
+  gboolean dark = compute_dark (self);
+  gboolean high_contrast = bis_settings_get_high_contrast (self->settings);
+  gboolean notify_dark = dark != self->dark;
+  gboolean notify_hc = high_contrast != self->high_contrast;
+
+  self->dark = dark;
+  self->high_contrast = high_contrast;
+
+  update_provider (self);
+
+  g_object_freeze_notify (G_OBJECT (self));
+
+  if (notify_dark)
+    g_object_notify_by_pspec (G_OBJECT (self), props[PROP_DARK]);
+  if (notify_hc)
+    g_object_notify_by_pspec (G_OBJECT (self), props[PROP_HIGH_CONTRAST]);
+
+  g_object_thaw_notify (G_OBJECT (self));
+}
+
+static void update_frame_cb (BisStyleManager *self);
+
+static void
+cancel_update (BisStyleManager *self)
+{
+  guint i;
+
+  g_clear_handle_id (&self->update_source_id, g_source_remove);
+
+  for (i = 0; i < self->update_clocks->len; i++)
+    g_signal_handlers_disconnect_by_func (g_ptr_array_index (self->update_clocks, i),
+                                          update_frame_cb, self);
+
+  g_ptr_array_set_size (self->update_clocks, 0);
+}
+
+static void
+update_frame_cb (BisStyleManager *self)
+{
+  cancel_update (self);
+
+  update_style (self);
+}
+
+static gboolean
+update_source_cb (BisStyleManager *self)
+{
+  self->update_source_id = 0;
+
+  cancel_update (self);
+
+  update_style (self);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+queue_update (BisStyleManager *self)
+{
+  GListModel *toplevels;
+  guint i, n_toplevels;
+
+  if (self->update_source_id)
+    return;
+
+  toplevels = gtk_window_get_toplevels ();
+  n_toplevels = g_list_model_get_n_items (toplevels);
+
+  for (i = 0; i < n_toplevels; i++) {
+    GtkWidget *window = g_list_model_get_item (toplevels, i);
+    GdkFrameClock *clock = NULL;
+
+    if (gtk_widget_get_mapped (window) &&
+        gtk_widget_get_display (window) == self->display)
+      clock = gtk_widget_get_frame_clock (window);
+
+    if (clock) {
+      g_signal_connect_swapped (clock, "update",
+                                G_CALLBACK (update_frame_cb), self);
+      gdk_frame_clock_request_phase (clock, GDK_FRAME_CLOCK_PHASE_UPDATE);
+
+      g_ptr_array_add (self->update_clocks, g_object_ref (clock));
+    }
+
+    g_object_unref (window);
+  }
+
+  if (self->update_clocks->len > 0)
+    self->update_source_id =
+      g_timeout_add_full (UPDATE_PRIORITY, UPDATE_TIMEOUT_DURATION,
+                          (GSourceFunc) update_source_cb, self, NULL);
+  else
+    self->update_source_id =
+      g_idle_add_full (UPDATE_PRIORITY, (GSourceFunc) update_source_cb, self, NULL);
+}
+
+static void
+notify_system_supports_color_schemes_cb (BisStyleManager *self)
+{
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_SYSTEM_SUPPORTS_COLOR_SCHEMES]);
+}
+
+static void
+bis_style_manager_constructed (GObject *object)
+{
+  BisStyleManager *self = BIS_STYLE_MANAGER (object);
+
+  G_OBJECT_CLASS (bis_style_manager_parent_class)->constructed (object);
+
+  g_set_object (&self->display, gdk_display_get_default ());
+  self->settings = bis_settings_get_default ();
+
+  g_signal_connect_object (gdk_display_manager_get (),
+                           "notify::default-display",
+                           G_CALLBACK (update_provider),
+                           self,
+                           G_CONNECT_SWAPPED);
+  g_signal_connect_object (self->settings,
+                           "notify::system-supports-color-schemes",
+                           G_CALLBACK (notify_system_supports_color_schemes_cb),
+                           self,
+                           G_CONNECT_SWAPPED);
+  g_signal_connect_object (self->settings,
+                           "notify::color-scheme",
+                           G_CALLBACK (queue_update),
+                           self,
+                           G_CONNECT_SWAPPED);
+  g_signal_connect_object (self->settings,
+                           "notify::high-contrast",
+                           G_CALLBACK (queue_update),
+                           self,
+                           G_CONNECT_SWAPPED);
+
+  self->dark = compute_dark (self);
+  self->high_contrast = bis_settings_get_high_contrast (self->settings);
+}
+
+static void
+bis_style_manager_dispose (GObject *object)
+{
+  BisStyleManager *self = BIS_STYLE_MANAGER (object);
+  int i;
+
+  if (self->update_clocks) {
+    cancel_update (self);
+    g_clear_pointer (&self->update_clocks, g_ptr_array_unref);
+  }
+
+  if (self->display && self->applied_provider)
+    gtk_style_context_remove_provider_for_display (self->display,
+                                                   GTK_STYLE_PROVIDER (self->applied_provider));
+
+  g_clear_object (&self->applied_provider);
+  g_clear_object (&self->display);
+
+  for (i = 0; i < N_STYLE_VARIANTS; i++)
+    g_clear_object (&self->providers[i]);
+
+  G_OBJECT_CLASS (bis_style_manager_parent_class)->dispose (object);
+}
+
+static void
+bis_style_manager_get_property (GObject    *object,
+                                guint       prop_id,
+                                GValue     *value,
+                                GParamSpec *pspec)
+{
+  BisStyleManager *self = BIS_STYLE_MANAGER (object);
+
+  switch (prop_id) {
+  case PROP_COLOR_SCHEME:
+    g_value_set_enum (value, bis_style_manager_get_color_scheme (self));
+    break;
+
+  case PROP_SYSTEM_SUPPORTS_COLOR_SCHEMES:
+    g_value_set_boolean (value, bis_style_manager_get_system_supports_color_schemes (self));
+    break;
+
+  case PROP_DARK:
+    g_value_set_boolean (value, bis_style_manager_get_dark (self));
+    break;
+
+  case PROP_HIGH_CONTRAST:
+    g_value_set_boolean (value, bis_style_manager_get_high_contrast (self));
+    break;
+
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+static void
+bis_style_manager_set_property (GObject      *object,
+                                guint         prop_id,
+                                const GValue *value,
+                                GParamSpec   *pspec)
+{
+  BisStyleManager *self = BIS_STYLE_MANAGER (object);
+
+  switch (prop_id) {
+  case PROP_COLOR_SCHEME:
+    bis_style_manager_set_color_scheme (self, g_value_get_enum (value));
+    break;
+
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+static void
+bis_style_manager_class_init (BisStyleManagerClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->constructed = bis_style_manager_constructed;
+  object_class->dispose = bis_style_manager_dispose;
+  object_class->get_property = bis_style_manager_get_property;
+  object_class->set_property = bis_style_manager_set_property;
+
+  /**
+   * BisStyleManager:color-scheme: (attributes org.gtk.Property.get=bis_style_manager_get_color_scheme org.gtk.Property.set=bis_style_manager_set_color_scheme)
+   *
+   * The requested application color scheme.
+   *
+   * The effective appearance is reflected by [property@StyleManager:dark].
+   *
+   * Since: 1.0
+   */
+  props[PROP_COLOR_SCHEME] =
+    g_param_spec_enum ("color-scheme", NULL, NULL,
+                       BIS_TYPE_COLOR_SCHEME,
+                       BIS_COLOR_SCHEME_DEFAULT,
+                       G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | G_PARAM_EXPLICIT_NOTIFY);
+
+  /**
+   * BisStyleManager:system-supports-color-schemes: (attributes org.gtk.Property.get=bis_style_manager_get_system_supports_color_schemes)
+   *
+   * Whether the system supports color schemes.
+   *
+   * Since: 1.0
+   */
+  props[PROP_SYSTEM_SUPPORTS_COLOR_SCHEMES] =
+    g_param_spec_boolean ("system-supports-color-schemes", NULL, NULL,
+                          FALSE,
+                          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  /**
+   * BisStyleManager:dark: (attributes org.gtk.Property.get=bis_style_manager_get_dark)
+   *
+   * Whether the dark variant is currently in use.
+   *
+   * Since: 1.0
+   */
+  props[PROP_DARK] =
+    g_param_spec_boolean ("dark", NULL, NULL,
+                          FALSE,
+                          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  /**
+   * BisStyleManager:high-contrast: (attributes org.gtk.Property.get=bis_style_manager_get_high_contrast)
+   *
+   * Whether the system asks for high contrast.
+   *
+   * The high contrast variants are used while this is `TRUE`. If no provider
+   * is set for them, the regular variants are used instead, so this doesn't
+   * mean a high contrast provider is applied.
+   *
+   * Since: 1.0
+   */
+  props[PROP_HIGH_CONTRAST] =
+    g_param_spec_boolean ("high-contrast", NULL, NULL,
+                          FALSE,
+                          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+
+  g_object_class_install_properties (object_class, LAST_PROP, props);
+}
+
+static void
+bis_style_manager_init (BisStyleManager *self)
+{
+  self->color_scheme = BIS_COLOR_SCHEME_DEFAULT;
+  self->update_clocks = g_ptr_array_new_with_free_func (g_object_unref);
+}
+
+/**
+ * bis_style_manager_get_default:
+ *
+ * Gets the default style manager instance.
+ *
+ * Returns: (transfer none): the default style manager
+ *
+ * Since: 1.0
+ */
+BisStyleManager *
+bis_style_manager_get_default (void)
+{
+  if (!default_instance)
+    default_instance = g_object_new (BIS_TYPE_STYLE_MANAGER, NULL);
+
+  return default_instance;
+}
+
+/**
+ * bis_style_manager_get_color_scheme: (attributes org.gtk.Method.get_property=color-scheme)
+ * @self: a style manager
+ *
+ * Gets the requested application color scheme.
+ *
+ * Returns: the color scheme
+ *
+ * Since: 1.0
+ */
+BisColorScheme
+bis_style_manager_get_color_scheme (BisStyleManager *self)
+{
+  g_return_val_if_fail (BIS_IS_STYLE_MANAGER (self), BIS_COLOR_SCHEME_DEFAULT);
+
+  return self->color_scheme;
+}
+
+/**
+ * bis_style_manager_set_color_scheme: (attributes org.gtk.Method.set_property=color-scheme)
+ * @self: a style manager
+ * @color_scheme: the color scheme
+ *
+ * Sets the requested application color scheme.
+ *
+ * The change is applied right away, so [property@StyleManager:dark] reflects
+ * it as soon as this function returns.
+ *
+ * Since: 1.0
+ */
+void
+bis_style_manager_set_color_scheme (BisStyleManager *self,
+                                    BisColorScheme   color_scheme)
+{
+  g_return_if_fail (BIS_IS_STYLE_MANAGER (self));
+  g_return_if_fail (color_scheme <= BIS_COLOR_SCHEME_FORCE_DARK);
+
+  if (color_scheme == self->color_scheme)
+    return;
+
+  g_object_freeze_notify (G_OBJECT (self));
+
+  self->color_scheme = color_scheme;
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_COLOR_SCHEME]);
+
+  /* This also applies any pending change of the system preferences */
+  cancel_update (self);
+  update_style (self);
+
+  g_object_thaw_notify (G_OBJECT (self));
+}
+
+/**
+ * bis_style_manager_get_system_supports_color_schemes: (attributes org.gtk.Method.get_property=system-supports-color-schemes)
+ * @self: a style manager
+ *
+ * Gets whether the system supports color schemes.
+ *
+ * Returns: whether the system supports color schemes
+ *
+ * Since: 1.0
+ */
+gboolean
+bis_style_manager_get_system_supports_color_schemes (BisStyleManager *self)
+{
+  g_return_val_if_fail (BIS_IS_STYLE_MANAGER (self), FALSE);
+
+  return bis_settings_get_system_supports_color_schemes (self->settings);
+}
+
+/**
+ * bis_style_manager_get_dark: (attributes org.gtk.Method.get_property=dark)
+ * @self: a style manager
+ *
+ * Gets whether the dark variant is currently in use.
+ *
+ * Returns: whether the dark variant is in use
+ *
+ * Since: 1.0
+ */
+gboolean
+bis_style_manager_get_dark (BisStyleManager *self)
+{
+  g_return_val_if_fail (BIS_IS_STYLE_MANAGER (self), FALSE);
+
+  return self->dark;
+}
+
+/**
+ * bis_style_manager_get_high_contrast: (attributes org.gtk.Method.get_property=high-contrast)
+ * @self: a style manager
+ *
+ * Gets whether the system asks for high contrast.
+ *
+ * The high contrast variants are used while this is `TRUE`. If no provider is
+ * set for them, the regular variants are used instead, so this doesn't mean a
+ * high contrast provider is applied.
+ *
+ * Returns: whether the system asks for high contrast
+ *
+ * Since: 1.0
+ */
+gboolean
+bis_style_manager_get_high_contrast (BisStyleManager *self)
+{
+  g_return_val_if_fail (BIS_IS_STYLE_MANAGER (self), FALSE);
+
+  return self->high_contrast;
+}
+
+/**
+ * bis_style_manager_get_css_provider:
+ * @self: a style manager
+ * @variant: a style variant
+ *
+ * Gets the CSS provider used for @variant.
+ *
+ * Returns: (transfer none) (nullable): the CSS provider
+ *
+ * Since: 1.0
+ */
+GtkCssProvider *
+bis_style_manager_get_css_provider (BisStyleManager *self,
+                                    BisStyleVariant  variant)
+{
+  g_return_val_if_fail (BIS_IS_STYLE_MANAGER (self), NULL);
+  g_return_val_if_fail (variant < N_STYLE_VARIANTS, NULL);
+
+  return self->providers[variant];
+}
+
+/**
+ * bis_style_manager_set_css_provider:
+ * @self: a style manager
+ * @variant: a style variant
+ * @provider: (nullable): a CSS provider
+ *
+ * Sets the CSS provider to use for @variant.
+ *
+ * @provider should already be loaded, it will be added to the default display
+ * while @variant is in use.
+ *
+ * Since: 1.0
+ */
+void
+bis_style_manager_set_css_provider (BisStyleManager *self,
+                                    BisStyleVariant  variant,
+                                    GtkCssProvider  *provider)
+{
+  g_return_if_fail (BIS_IS_STYLE_MANAGER (self));
+  g_return_if_fail (variant < N_STYLE_VARIANTS);
+  g_return_if_fail (provider == NULL || GTK_IS_CSS_PROVIDER (provider));
+
+  if (!g_set_object (&self->providers[variant], provider))
+    return;
+
+  update_provider (self);
+}
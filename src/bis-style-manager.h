@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#pragma once
+
+#if !defined(_BISMUTH_INSIDE) && !defined(BISMUTH_COMPILATION)
+#error "Only <bismuth.h> can be included directly."
+#endif
+
+#include "bis-version.h"
+
+#include <gtk/gtk.h>
+
+#include "bis-enums.h"
+
+G_BEGIN_DECLS
+
+typedef enum {
+  BIS_COLOR_SCHEME_DEFAULT,
+  BIS_COLOR_SCHEME_FORCE_LIGHT,
+  BIS_COLOR_SCHEME_PREFER_LIGHT,
+  BIS_COLOR_SCHEME_PREFER_DARK,
+  BIS_COLOR_SCHEME_FORCE_DARK,
+} BisColorScheme;
+
+typedef enum {
+  BIS_STYLE_VARIANT_LIGHT,
+  BIS_STYLE_VARIANT_DARK,
+  BIS_STYLE_VARIANT_HIGH_CONTRAST,
+  BIS_STYLE_VARIANT_HIGH_CONTRAST_DARK,
+} BisStyleVariant;
+
+#define BIS_TYPE_STYLE_MANAGER (bis_style_manager_get_type())
+
+BIS_AVAILABLE_IN_ALL
+G_DECLARE_FINAL_TYPE (BisStyleManager, bis_style_manager, BIS, STYLE_MANAGER, GObject)
+
+BIS_AVAILABLE_IN_ALL
+BisStyleManager *bis_style_manager_get_default (void);
+
+BIS_AVAILABLE_IN_ALL
+BisColorScheme bis_style_manager_get_color_scheme (BisStyleManager *self);
+BIS_AVAILABLE_IN_ALL
+void           bis_style_manager_set_color_scheme (BisStyleManager *self,
+                                                   BisColorScheme   color_scheme);
+
+BIS_AVAILABLE_IN_ALL
+gboolean bis_style_manager_get_system_supports_color_schemes (BisStyleManager *self);
+
+BIS_AVAILABLE_IN_ALL
+gboolean bis_style_manager_get_dark          (BisStyleManager *self);
+BIS_AVAILABLE_IN_ALL
+gboolean bis_style_manager_get_high_contrast (BisStyleManager *self);
+
+BIS_AVAILABLE_IN_ALL
+GtkCssProvider *bis_style_manager_get_css_provider (BisStyleManager *self,
+                                                    BisStyleVariant  variant);
+BIS_AVAILABLE_IN_ALL
+void            bis_style_manager_set_css_provider (BisStyleManager *self,
+                                                    BisStyleVariant  variant,
+                                                    GtkCssProvider  *provider);
+
+G_END_DECLS
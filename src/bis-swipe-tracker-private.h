@@ -18,4 +18,6 @@ G_BEGIN_DECLS
 
 void bis_swipe_tracker_reset (BisSwipeTracker *self);
 
+gboolean bis_swipe_tracker_is_swiping (BisSwipeTracker *self);
+
 G_END_DECLS
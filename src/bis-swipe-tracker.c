@@ -1453,3 +1453,13 @@ bis_swipe_tracker_reset (BisSwipeTracker *self)
   if (self->scroll_controller)
     gtk_event_controller_reset (self->scroll_controller);
 }
+
+/* Whether a swipe has been prepared and hasn't ended yet */
+gboolean
+bis_swipe_tracker_is_swiping (BisSwipeTracker *self)
+{
+  g_return_val_if_fail (BIS_IS_SWIPE_TRACKER (self), FALSE);
+
+  return self->state == BIS_SWIPE_TRACKER_STATE_PENDING ||
+         self->state == BIS_SWIPE_TRACKER_STATE_SCROLLING;
+}
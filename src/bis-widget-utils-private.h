@@ -48,4 +48,9 @@ gboolean bis_widget_lookup_color (GtkWidget  *widget,
                                   const char *name,
                                   GdkRGBA    *rgba);
 
+void bis_widget_prewarm_child (GtkWidget *widget,
+                               GtkWidget *child,
+                               int        width,
+                               int        height);
+
 G_END_DECLS
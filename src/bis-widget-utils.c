@@ -569,3 +569,26 @@ G_GNUC_BEGIN_IGNORE_DEPRECATIONS
   return gtk_style_context_lookup_color (context, name, rgba);
 G_GNUC_END_IGNORE_DEPRECATIONS
 }
+
+/* Measures and allocates @child, which @widget keeps hidden, at the given
+ * size, so that its styles and text layouts are ready when it's shown. It
+ * stays child-invisible, so it isn't mapped and nothing is drawn. Its
+ * allocation is kept, so showing it at the same size doesn't lay it out again.
+ */
+void
+bis_widget_prewarm_child (GtkWidget *widget,
+                          GtkWidget *child,
+                          int        width,
+                          int        height)
+{
+  if (!gtk_widget_get_mapped (widget) ||
+      !gtk_widget_get_visible (child) ||
+      gtk_widget_get_child_visible (child))
+    return;
+
+  gtk_widget_measure (child, GTK_ORIENTATION_HORIZONTAL, height,
+                      NULL, NULL, NULL, NULL);
+  gtk_widget_measure (child, GTK_ORIENTATION_VERTICAL, width,
+                      NULL, NULL, NULL, NULL);
+  gtk_widget_allocate (child, width, height, -1, NULL);
+}
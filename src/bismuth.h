@@ -34,6 +34,7 @@ G_BEGIN_DECLS
 #include "bis-easing.h"
 #include "bis-enum-list-model.h"
 #include "bis-lapel.h"
+#include "bis-loadable.h"
 #include "bis-fold-threshold-policy.h"
 #include "bis-album.h"
 #include "bis-main.h"
@@ -41,6 +42,7 @@ G_BEGIN_DECLS
 #include "bis-spring-animation.h"
 #include "bis-spring-params.h"
 #include "bis-hugger.h"
+#include "bis-style-manager.h"
 #include "bis-swipe-tracker.h"
 #include "bis-swipeable.h"
 #include "bis-timed-animation.h"
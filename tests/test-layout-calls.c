@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+/* Checks how many times containers measure and allocate each child per frame.
+ *
+ * Every frame, the probes are queued for resize in the frame clock's update
+ * phase, so that each frame lays out the whole container again. Their call
+ * counts are collected once the frame has been painted.
+ *
+ * Only the measurements that reach the probe's measure() are counted, that is
+ * the ones missing GTK's size request cache. A container asking again for a
+ * size it already asked for in the same frame is not caught here, since the
+ * second request is served from the cache. The repeated measurements removed
+ * from BisHugger's size_allocate() and BisLapel's compute_sizes() were of
+ * that kind, so this test would not notice them coming back.
+ */
+
+#include "test-probe.h"
+
+#include <string.h>
+
+#define TIMEOUT_USEC (5 * G_USEC_PER_SEC)
+#define N_FRAMES 5
+
+/* A probe is expected to be measured for its width and height with no
+ * for_size, plus for its height at two widths: the one the container is
+ * measured for by the window, passed on to its children, and the width the
+ * container gets from gtk_widget_get_preferred_size() or allocates it.
+ */
+#define MAX_MEASUREMENTS_PER_FRAME 4
+#define MAX_ALLOCATIONS_PER_FRAME 1
+
+typedef struct _LayoutTest LayoutTest;
+
+/* Called in the update phase of each frame, before the probes are reset.
+ * Returns FALSE once the scenario is over. */
+typedef gboolean (* FrameFunc) (LayoutTest *test);
+
+struct _LayoutTest {
+  const char *name;
+  GtkWidget *widget;
+  GPtrArray *probes;
+  FrameFunc frame_func;
+
+  gboolean in_frame;
+  gboolean done;
+  guint n_frames;
+  guint max_measurements;
+  guint max_allocations;
+};
+
+static GtkWidget *
+show_in_window (GtkWidget *child,
+                int        width,
+                int        height)
+{
+  GtkWidget *window = gtk_window_new ();
+
+  gtk_window_set_default_size (GTK_WINDOW (window), width, height);
+  gtk_window_set_child (GTK_WINDOW (window), child);
+  gtk_window_present (GTK_WINDOW (window));
+
+  while (!gtk_widget_get_mapped (child))
+    g_main_context_iteration (NULL, TRUE);
+
+  return window;
+}
+
+static GtkWidget *
+add_probe (LayoutTest *test,
+           int         width,
+           int         height)
+{
+  GtkWidget *probe = test_probe_new (width, height);
+
+  g_ptr_array_add (test->probes, probe);
+
+  return probe;
+}
+
+static void
+update_cb (GdkFrameClock *clock,
+           LayoutTest    *test)
+{
+  guint i;
+
+  if (test->done)
+    return;
+
+  if (!test->frame_func (test)) {
+    test->done = TRUE;
+    return;
+  }
+
+  for (i = 0; i < test->probes->len; i++) {
+    TestProbe *probe = g_ptr_array_index (test->probes, i);
+
+    test_probe_reset_counts (probe);
+    gtk_widget_queue_resize (GTK_WIDGET (probe));
+  }
+
+  test->in_frame = TRUE;
+}
+
+static void
+after_paint_cb (GdkFrameClock *clock,
+                LayoutTest    *test)
+{
+  guint i;
+
+  if (!test->in_frame)
+    return;
+
+  for (i = 0; i < test->probes->len; i++) {
+    TestProbe *probe = g_ptr_array_index (test->probes, i);
+
+    test->max_measurements = MAX (test->max_measurements,
+                                  test_probe_get_measure_count (probe));
+    test->max_allocations = MAX (test->max_allocations,
+                                 test_probe_get_allocate_count (probe));
+  }
+
+  test->in_frame = FALSE;
+  test->n_frames++;
+}
+
+static void
+run_frames (LayoutTest *test)
+{
+  GdkFrameClock *clock = gtk_widget_get_frame_clock (test->widget);
+  gint64 deadline = g_get_monotonic_time () + TIMEOUT_USEC;
+  gulong update_id, after_paint_id;
+
+  g_assert_nonnull (clock);
+
+  update_id = g_signal_connect (clock, "update",
+                                G_CALLBACK (update_cb), test);
+  after_paint_id = g_signal_connect (clock, "after-paint",
+                                     G_CALLBACK (after_paint_cb), test);
+
+  while (!test->done && g_get_monotonic_time () < deadline) {
+    gtk_widget_queue_draw (test->widget);
+    g_main_context_iteration (NULL, TRUE);
+  }
+
+  g_signal_handler_disconnect (clock, update_id);
+  g_signal_handler_disconnect (clock, after_paint_id);
+
+  g_test_message ("%s: %u frames, at most %u measurements and %u allocations "
+                  "of a child per frame", test->name, test->n_frames,
+                  test->max_measurements, test->max_allocations);
+
+  g_assert_true (test->done);
+  g_assert_cmpuint (test->n_frames, >, 0);
+  g_assert_cmpuint (test->max_measurements, <=, MAX_MEASUREMENTS_PER_FRAME);
+  g_assert_cmpuint (test->max_allocations, <=, MAX_ALLOCATIONS_PER_FRAME);
+}
+
+static void
+wait_for_frames (GtkWidget *widget,
+                 guint      n_frames)
+{
+  GdkFrameClock *clock = gtk_widget_get_frame_clock (widget);
+  gint64 target = gdk_frame_clock_get_frame_counter (clock) + n_frames;
+
+  while (gdk_frame_clock_get_frame_counter (clock) < target) {
+    gtk_widget_queue_draw (widget);
+    g_main_context_iteration (NULL, TRUE);
+  }
+}
+
+static void
+layout_test_init (LayoutTest *test,
+                  const char *name,
+                  FrameFunc   frame_func)
+{
+  memset (test, 0, sizeof (LayoutTest));
+
+  test->name = name;
+  test->probes = g_ptr_array_new ();
+  test->frame_func = frame_func;
+}
+
+static void
+layout_test_finish (LayoutTest *test,
+                    GtkWidget  *window)
+{
+  gtk_window_destroy (GTK_WINDOW (window));
+  g_ptr_array_unref (test->probes);
+}
+
+static gboolean
+count_frames (LayoutTest *test)
+{
+  return test->n_frames < N_FRAMES;
+}
+
+static gboolean
+album_transition_running (LayoutTest *test)
+{
+  return bis_album_get_child_transition_running (BIS_ALBUM (test->widget));
+}
+
+static gboolean
+resize_widget (LayoutTest *test)
+{
+  gtk_widget_set_size_request (test->widget,
+                               test->n_frames % 2 ? 300 : 500, -1);
+
+  return test->n_frames < N_FRAMES;
+}
+
+static gboolean
+lapel_revealing (LayoutTest *test)
+{
+  return bis_lapel_get_reveal_progress (BIS_LAPEL (test->widget)) < 1;
+}
+
+static gboolean
+carousel_scrolling (LayoutTest *test)
+{
+  BisCarousel *carousel = BIS_CAROUSEL (test->widget);
+
+  return bis_carousel_get_position (carousel) != bis_carousel_get_n_pages (carousel) - 1;
+}
+
+static void
+test_album_idle (void)
+{
+  LayoutTest test;
+  GtkWidget *window;
+  int i;
+
+  layout_test_init (&test, "album-idle", count_frames);
+
+  test.widget = bis_album_new ();
+  for (i = 0; i < 3; i++)
+    bis_album_append (BIS_ALBUM (test.widget), add_probe (&test, 200, 200));
+
+  window = show_in_window (test.widget, 800, 300);
+
+  g_assert_false (bis_album_get_folded (BIS_ALBUM (test.widget)));
+
+  run_frames (&test);
+
+  layout_test_finish (&test, window);
+}
+
+static void
+test_album_transition (void)
+{
+  LayoutTest test;
+  GtkWidget *window;
+
+  layout_test_init (&test, "album-transition", album_transition_running);
+
+  test.widget = bis_album_new ();
+  bis_album_append (BIS_ALBUM (test.widget), add_probe (&test, 200, 200));
+  bis_album_append (BIS_ALBUM (test.widget), add_probe (&test, 200, 200));
+
+  window = show_in_window (test.widget, 300, 300);
+
+  g_assert_true (bis_album_get_folded (BIS_ALBUM (test.widget)));
+
+  bis_album_set_visible_child (BIS_ALBUM (test.widget),
+                               g_ptr_array_index (test.probes, 1));
+
+  run_frames (&test);
+
+  layout_test_finish (&test, window);
+}
+
+static void
+test_hugger_resize (void)
+{
+  LayoutTest test;
+  GtkWidget *window;
+
+  layout_test_init (&test, "hugger-resize", resize_widget);
+
+  test.widget = bis_hugger_new ();
+  gtk_widget_set_halign (test.widget, GTK_ALIGN_START);
+  bis_hugger_add (BIS_HUGGER (test.widget), add_probe (&test, 250, 200));
+  bis_hugger_add (BIS_HUGGER (test.widget), add_probe (&test, 100, 200));
+
+  window = show_in_window (test.widget, 600, 300);
+
+  run_frames (&test);
+
+  layout_test_finish (&test, window);
+}
+
+static void
+test_lapel_reveal (void)
+{
+  LayoutTest test;
+  GtkWidget *window;
+
+  layout_test_init (&test, "lapel-reveal", lapel_revealing);
+
+  test.widget = bis_lapel_new ();
+  bis_lapel_set_content (BIS_LAPEL (test.widget), add_probe (&test, 200, 200));
+  bis_lapel_set_lapel (BIS_LAPEL (test.widget), add_probe (&test, 200, 200));
+
+  window = show_in_window (test.widget, 300, 300);
+
+  g_assert_true (bis_lapel_get_folded (BIS_LAPEL (test.widget)));
+
+  /* Let the lapel finish hiding after folding */
+  while (bis_lapel_get_reveal_progress (BIS_LAPEL (test.widget)) > 0)
+    wait_for_frames (test.widget, 1);
+
+  bis_lapel_set_reveal_lapel (BIS_LAPEL (test.widget), TRUE);
+
+  run_frames (&test);
+
+  layout_test_finish (&test, window);
+}
+
+static void
+test_carousel_scroll (void)
+{
+  LayoutTest test;
+  GtkWidget *window;
+  int i;
+
+  layout_test_init (&test, "carousel-scroll", carousel_scrolling);
+
+  test.widget = bis_carousel_new ();
+  for (i = 0; i < 5; i++)
+    bis_carousel_append (BIS_CAROUSEL (test.widget), add_probe (&test, 100, 100));
+
+  window = show_in_window (test.widget, 300, 300);
+
+  bis_carousel_scroll_to (BIS_CAROUSEL (test.widget),
+                          g_ptr_array_index (test.probes, 4), TRUE);
+
+  run_frames (&test);
+
+  layout_test_finish (&test, window);
+}
+
+static void
+test_latch_resize (void)
+{
+  LayoutTest test;
+  GtkWidget *window;
+
+  layout_test_init (&test, "latch-resize", resize_widget);
+
+  test.widget = bis_latch_new ();
+  gtk_widget_set_halign (test.widget, GTK_ALIGN_START);
+  bis_latch_set_maximum_size (BIS_LATCH (test.widget), 400);
+  bis_latch_set_child (BIS_LATCH (test.widget), add_probe (&test, 100, 100));
+
+  window = show_in_window (test.widget, 600, 300);
+
+  run_frames (&test);
+
+  layout_test_finish (&test, window);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv, NULL);
+  bis_init ();
+
+  g_test_add_func ("/Bismuth/LayoutCalls/album_idle", test_album_idle);
+  g_test_add_func ("/Bismuth/LayoutCalls/album_transition", test_album_transition);
+  g_test_add_func ("/Bismuth/LayoutCalls/hugger_resize", test_hugger_resize);
+  g_test_add_func ("/Bismuth/LayoutCalls/lapel_reveal", test_lapel_reveal);
+  g_test_add_func ("/Bismuth/LayoutCalls/carousel_scroll", test_carousel_scroll);
+  g_test_add_func ("/Bismuth/LayoutCalls/latch_resize", test_latch_resize);
+
+  return g_test_run ();
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#include <bismuth.h>
+
+#define TIMEOUT_USEC (5 * G_USEC_PER_SEC)
+
+#define TEST_TYPE_LOADABLE (test_loadable_get_type())
+
+G_DECLARE_FINAL_TYPE (TestLoadable, test_loadable, TEST, LOADABLE, GtkWidget)
+
+struct _TestLoadable
+{
+  GtkWidget parent_instance;
+
+  guint n_loads;
+};
+
+static void test_loadable_loadable_init (BisLoadableInterface *iface);
+
+G_DEFINE_FINAL_TYPE_WITH_CODE (TestLoadable, test_loadable, GTK_TYPE_WIDGET,
+                               G_IMPLEMENT_INTERFACE (BIS_TYPE_LOADABLE, test_loadable_loadable_init))
+
+static void
+test_loadable_load_async (BisLoadable         *loadable,
+                          GCancellable        *cancellable,
+                          GAsyncReadyCallback  callback,
+                          gpointer             user_data)
+{
+  TestLoadable *self = TEST_LOADABLE (loadable);
+  GTask *task = g_task_new (self, cancellable, callback, user_data);
+
+  self->n_loads++;
+
+  g_task_return_boolean (task, TRUE);
+  g_object_unref (task);
+}
+
+static gboolean
+test_loadable_load_finish (BisLoadable   *loadable,
+                           GAsyncResult  *result,
+                           GError       **error)
+{
+  return g_task_propagate_boolean (G_TASK (result), error);
+}
+
+static void
+test_loadable_class_init (TestLoadableClass *klass)
+{
+}
+
+static void
+test_loadable_init (TestLoadable *self)
+{
+  gtk_widget_set_size_request (GTK_WIDGET (self), 200, 200);
+}
+
+static void
+test_loadable_loadable_init (BisLoadableInterface *iface)
+{
+  iface->load_async = test_loadable_load_async;
+  iface->load_finish = test_loadable_load_finish;
+}
+
+static GtkWidget *
+show_in_window (GtkWidget *child,
+                int        width,
+                int        height)
+{
+  GtkWidget *window = gtk_window_new ();
+
+  gtk_window_set_default_size (GTK_WINDOW (window), width, height);
+  gtk_window_set_child (GTK_WINDOW (window), child);
+  gtk_window_present (GTK_WINDOW (window));
+
+  while (!gtk_widget_get_mapped (child))
+    g_main_context_iteration (NULL, TRUE);
+
+  return window;
+}
+
+static gboolean
+wait_for_loaded (GtkWidget *widget)
+{
+  gint64 deadline = g_get_monotonic_time () + TIMEOUT_USEC;
+
+  while (!bis_loadable_get_loaded (BIS_LOADABLE (widget)) &&
+         g_get_monotonic_time () < deadline) {
+    gtk_widget_queue_draw (widget);
+    g_main_context_iteration (NULL, TRUE);
+  }
+
+  return bis_loadable_get_loaded (BIS_LOADABLE (widget));
+}
+
+static void
+test_album_unfolded (void)
+{
+  GtkWidget *album = bis_album_new ();
+  GtkWidget *pages[3];
+  GtkWidget *window;
+  int i;
+
+  for (i = 0; i < G_N_ELEMENTS (pages); i++) {
+    pages[i] = g_object_new (TEST_TYPE_LOADABLE, NULL);
+    bis_album_append (BIS_ALBUM (album), pages[i]);
+  }
+
+  window = show_in_window (album, 800, 300);
+
+  g_assert_false (bis_album_get_folded (BIS_ALBUM (album)));
+
+  /* Every page is shown, not just the visible child */
+  for (i = 0; i < G_N_ELEMENTS (pages); i++)
+    g_assert_true (wait_for_loaded (pages[i]));
+
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
+static void
+test_album_folded (void)
+{
+  GtkWidget *album = bis_album_new ();
+  GtkWidget *first = g_object_new (TEST_TYPE_LOADABLE, NULL);
+  GtkWidget *second = g_object_new (TEST_TYPE_LOADABLE, NULL);
+  GtkWidget *window;
+
+  bis_album_append (BIS_ALBUM (album), first);
+  bis_album_append (BIS_ALBUM (album), second);
+
+  window = show_in_window (album, 300, 300);
+
+  g_assert_true (bis_album_get_folded (BIS_ALBUM (album)));
+  g_assert_true (wait_for_loaded (first));
+  g_assert_false (bis_loadable_get_loaded (BIS_LOADABLE (second)));
+  g_assert_cmpuint (TEST_LOADABLE (second)->n_loads, ==, 0);
+
+  bis_album_set_visible_child (BIS_ALBUM (album), second);
+
+  g_assert_true (wait_for_loaded (second));
+
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
+static void
+test_carousel_remove_current (void)
+{
+  GtkWidget *carousel = bis_carousel_new ();
+  GtkWidget *first = g_object_new (TEST_TYPE_LOADABLE, NULL);
+  GtkWidget *second = g_object_new (TEST_TYPE_LOADABLE, NULL);
+  GtkWidget *window;
+
+  /* Make the pages as wide as the carousel, so only one is shown at a time */
+  gtk_widget_set_hexpand (first, TRUE);
+  gtk_widget_set_hexpand (second, TRUE);
+
+  bis_carousel_append (BIS_CAROUSEL (carousel), first);
+  bis_carousel_append (BIS_CAROUSEL (carousel), second);
+
+  window = show_in_window (carousel, 300, 300);
+
+  g_assert_true (wait_for_loaded (first));
+  g_assert_cmpuint (TEST_LOADABLE (second)->n_loads, ==, 0);
+
+  /* The carousel moves on to the next page, which must be loaded */
+  bis_carousel_remove (BIS_CAROUSEL (carousel), first);
+
+  g_assert_true (wait_for_loaded (second));
+
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv, NULL);
+  bis_init ();
+
+  g_test_add_func ("/Bismuth/Loadable/album_unfolded", test_album_unfolded);
+  g_test_add_func ("/Bismuth/Loadable/album_folded", test_album_folded);
+  g_test_add_func ("/Bismuth/Loadable/carousel_remove_current", test_carousel_remove_current);
+
+  return g_test_run ();
+}
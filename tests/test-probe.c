@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#include "test-probe.h"
+
+/* A child widget with a fixed minimum size that draws a single color node,
+ * so that the render nodes and layout calls of the containers under test
+ * are not mixed up with the ones of a themed widget.
+ *
+ * It also counts its measure() and size_allocate() calls. Since it's
+ * height-for-width, GTK only caches its sizes per for_size, so every distinct
+ * measurement a container asks for reaches measure().
+ */
+struct _TestProbe
+{
+  GtkWidget parent_instance;
+
+  int width;
+  int height;
+
+  guint measure_count;
+  guint allocate_count;
+};
+
+G_DEFINE_FINAL_TYPE (TestProbe, test_probe, GTK_TYPE_WIDGET)
+
+static void
+test_probe_measure (GtkWidget      *widget,
+                    GtkOrientation  orientation,
+                    int             for_size,
+                    int            *minimum,
+                    int            *natural,
+                    int            *minimum_baseline,
+                    int            *natural_baseline)
+{
+  TestProbe *self = TEST_PROBE (widget);
+  int size = orientation == GTK_ORIENTATION_HORIZONTAL ? self->width : self->height;
+
+  self->measure_count++;
+
+  *minimum = size;
+  *natural = size;
+}
+
+static GtkSizeRequestMode
+test_probe_get_request_mode (GtkWidget *widget)
+{
+  return GTK_SIZE_REQUEST_HEIGHT_FOR_WIDTH;
+}
+
+static void
+test_probe_size_allocate (GtkWidget *widget,
+                          int        width,
+                          int        height,
+                          int        baseline)
+{
+  TestProbe *self = TEST_PROBE (widget);
+
+  self->allocate_count++;
+}
+
+static void
+test_probe_snapshot (GtkWidget   *widget,
+                     GtkSnapshot *snapshot)
+{
+  gtk_snapshot_append_color (snapshot,
+                             &(GdkRGBA) { 0.2, 0.4, 0.6, 1 },
+                             &GRAPHENE_RECT_INIT (0, 0,
+                                                  gtk_widget_get_width (widget),
+                                                  gtk_widget_get_height (widget)));
+}
+
+static void
+test_probe_class_init (TestProbeClass *klass)
+{
+  GtkWidgetClass *widget_class = GTK_WIDGET_CLASS (klass);
+
+  widget_class->measure = test_probe_measure;
+  widget_class->get_request_mode = test_probe_get_request_mode;
+  widget_class->size_allocate = test_probe_size_allocate;
+  widget_class->snapshot = test_probe_snapshot;
+}
+
+static void
+test_probe_init (TestProbe *self)
+{
+}
+
+GtkWidget *
+test_probe_new (int width,
+                int height)
+{
+  TestProbe *self = g_object_new (TEST_TYPE_PROBE, NULL);
+
+  self->width = width;
+  self->height = height;
+
+  return GTK_WIDGET (self);
+}
+
+void
+test_probe_set_size (TestProbe *self,
+                     int        width,
+                     int        height)
+{
+  g_return_if_fail (TEST_IS_PROBE (self));
+
+  if (self->width == width && self->height == height)
+    return;
+
+  self->width = width;
+  self->height = height;
+
+  gtk_widget_queue_resize (GTK_WIDGET (self));
+}
+
+guint
+test_probe_get_measure_count (TestProbe *self)
+{
+  g_return_val_if_fail (TEST_IS_PROBE (self), 0);
+
+  return self->measure_count;
+}
+
+guint
+test_probe_get_allocate_count (TestProbe *self)
+{
+  g_return_val_if_fail (TEST_IS_PROBE (self), 0);
+
+  return self->allocate_count;
+}
+
+void
+test_probe_reset_counts (TestProbe *self)
+{
+  g_return_if_fail (TEST_IS_PROBE (self));
+
+  self->measure_count = 0;
+  self->allocate_count = 0;
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#pragma once
+
+#include <bismuth.h>
+
+G_BEGIN_DECLS
+
+#define TEST_TYPE_PROBE (test_probe_get_type())
+
+G_DECLARE_FINAL_TYPE (TestProbe, test_probe, TEST, PROBE, GtkWidget)
+
+GtkWidget *test_probe_new (int width,
+                           int height);
+
+void test_probe_set_size (TestProbe *self,
+                          int        width,
+                          int        height);
+
+guint test_probe_get_measure_count  (TestProbe *self);
+guint test_probe_get_allocate_count (TestProbe *self);
+
+void test_probe_reset_counts (TestProbe *self);
+
+G_END_DECLS
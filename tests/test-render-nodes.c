@@ -0,0 +1,407 @@
+/*
+ * Copyright (C) 2026 The libbismuth authors
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+/* Snapshots widgets in fixed states and checks the number of render nodes
+ * of each type against the budgets in render-node-budgets.ini.
+ *
+ * Only the widget's own snapshot vfunc is called, so the counts don't depend
+ * on the theme drawing a background for it. The children are probes drawing
+ * a single color node each.
+ *
+ * When BIS_RENDER_NODE_BUDGETS_RECORD is set to a file name, nothing is
+ * checked. Instead, the measured counts for every key in the budgets are
+ * written to that file, which can then replace render-node-budgets.ini:
+ *
+ *   BIS_RENDER_NODE_BUDGETS_RECORD=$PWD/tests/render-node-budgets.ini \
+ *     xvfb-run meson test -C _build test-render-nodes
+ */
+
+#include "test-probe.h"
+
+#define TIMEOUT_USEC (5 * G_USEC_PER_SEC)
+#define MAX_NODE_TYPES 64
+
+typedef gboolean (* ReadyFunc) (GtkWidget *widget);
+
+typedef struct {
+  guint counts[MAX_NODE_TYPES];
+  guint total;
+} NodeCounts;
+
+typedef struct {
+  GtkWidget *widget;
+  ReadyFunc ready;
+  GskRenderNode *node;
+  gboolean done;
+} SnapshotData;
+
+static void
+count_nodes (GskRenderNode *node,
+             NodeCounts    *counts)
+{
+  GskRenderNodeType type;
+  guint i;
+
+  if (!node)
+    return;
+
+  type = gsk_render_node_get_node_type (node);
+
+  g_assert_cmpuint (type, <, MAX_NODE_TYPES);
+
+  counts->counts[type]++;
+  counts->total++;
+
+  if (type == GSK_CONTAINER_NODE) {
+    for (i = 0; i < gsk_container_node_get_n_children (node); i++)
+      count_nodes (gsk_container_node_get_child (node, i), counts);
+  } else if (type == GSK_TRANSFORM_NODE) {
+    count_nodes (gsk_transform_node_get_child (node), counts);
+  } else if (type == GSK_OPACITY_NODE) {
+    count_nodes (gsk_opacity_node_get_child (node), counts);
+  } else if (type == GSK_COLOR_MATRIX_NODE) {
+    count_nodes (gsk_color_matrix_node_get_child (node), counts);
+  } else if (type == GSK_REPEAT_NODE) {
+    count_nodes (gsk_repeat_node_get_child (node), counts);
+  } else if (type == GSK_CLIP_NODE) {
+    count_nodes (gsk_clip_node_get_child (node), counts);
+  } else if (type == GSK_ROUNDED_CLIP_NODE) {
+    count_nodes (gsk_rounded_clip_node_get_child (node), counts);
+  } else if (type == GSK_SHADOW_NODE) {
+    count_nodes (gsk_shadow_node_get_child (node), counts);
+  } else if (type == GSK_BLEND_NODE) {
+    count_nodes (gsk_blend_node_get_bottom_child (node), counts);
+    count_nodes (gsk_blend_node_get_top_child (node), counts);
+  } else if (type == GSK_CROSS_FADE_NODE) {
+    count_nodes (gsk_cross_fade_node_get_start_child (node), counts);
+    count_nodes (gsk_cross_fade_node_get_end_child (node), counts);
+  } else if (type == GSK_BLUR_NODE) {
+    count_nodes (gsk_blur_node_get_child (node), counts);
+  } else if (type == GSK_DEBUG_NODE) {
+    count_nodes (gsk_debug_node_get_child (node), counts);
+  }
+}
+
+static GskRenderNodeType
+node_type_from_nick (const char *nick)
+{
+  GEnumClass *enum_class = g_type_class_ref (GSK_TYPE_RENDER_NODE_TYPE);
+  GEnumValue *value = g_enum_get_value_by_nick (enum_class, nick);
+  GskRenderNodeType type;
+
+  if (!value)
+    g_error ("Unknown render node type in budget: %s", nick);
+
+  type = value->value;
+
+  g_type_class_unref (enum_class);
+
+  return type;
+}
+
+static void
+check_budget (const char    *scenario,
+              GskRenderNode *node)
+{
+  GKeyFile *budgets = g_key_file_new ();
+  NodeCounts counts = { { 0 }, 0 };
+  GError *error = NULL;
+  const char *record;
+  char *filename;
+  char **keys;
+  guint i;
+
+  record = g_getenv ("BIS_RENDER_NODE_BUDGETS_RECORD");
+
+  /* Each scenario adds its counts to what the previous ones recorded */
+  if (record && g_file_test (record, G_FILE_TEST_EXISTS))
+    filename = g_strdup (record);
+  else
+    filename = g_test_build_filename (G_TEST_DIST, "render-node-budgets.ini", NULL);
+
+  g_key_file_load_from_file (budgets, filename, G_KEY_FILE_KEEP_COMMENTS, &error);
+  g_assert_no_error (error);
+
+  keys = g_key_file_get_keys (budgets, scenario, NULL, &error);
+  g_assert_no_error (error);
+
+  count_nodes (node, &counts);
+
+  for (i = 0; keys[i]; i++) {
+    int budget = g_key_file_get_integer (budgets, scenario, keys[i], &error);
+    guint count;
+
+    g_assert_no_error (error);
+
+    if (!g_strcmp0 (keys[i], "total"))
+      count = counts.total;
+    else
+      count = counts.counts[node_type_from_nick (keys[i])];
+
+    g_test_message ("%s: %u %s, budget %d", scenario, count, keys[i], budget);
+
+    if (record)
+      g_key_file_set_integer (budgets, scenario, keys[i], count);
+    else
+      g_assert_cmpint (count, <=, budget);
+  }
+
+  if (record) {
+    g_key_file_save_to_file (budgets, record, &error);
+    g_assert_no_error (error);
+  }
+
+  g_strfreev (keys);
+  g_free (filename);
+  g_key_file_unref (budgets);
+}
+
+static GtkWidget *
+show_in_window (GtkWidget *child,
+                int        width,
+                int        height)
+{
+  GtkWidget *window = gtk_window_new ();
+
+  gtk_window_set_default_size (GTK_WINDOW (window), width, height);
+  gtk_window_set_child (GTK_WINDOW (window), child);
+  gtk_window_present (GTK_WINDOW (window));
+
+  while (!gtk_widget_get_mapped (child))
+    g_main_context_iteration (NULL, TRUE);
+
+  return window;
+}
+
+static void
+wait_for (GtkWidget *widget,
+          ReadyFunc  ready)
+{
+  gint64 deadline = g_get_monotonic_time () + TIMEOUT_USEC;
+
+  while (!ready (widget) && g_get_monotonic_time () < deadline) {
+    gtk_widget_queue_draw (widget);
+    g_main_context_iteration (NULL, TRUE);
+  }
+
+  g_assert_true (ready (widget));
+}
+
+static void
+after_paint_cb (GdkFrameClock *clock,
+                SnapshotData  *data)
+{
+  GtkSnapshot *snapshot;
+
+  if (data->done || !data->ready (data->widget))
+    return;
+
+  snapshot = gtk_snapshot_new ();
+  GTK_WIDGET_GET_CLASS (data->widget)->snapshot (data->widget, snapshot);
+
+  data->node = gtk_snapshot_free_to_node (snapshot);
+  data->done = TRUE;
+}
+
+/* Takes the snapshot right after a frame in which @ready returns TRUE, so that
+ * the state being checked is one that actually gets drawn. */
+static GskRenderNode *
+snapshot_when_ready (GtkWidget *widget,
+                     ReadyFunc  ready)
+{
+  SnapshotData data = { widget, ready, NULL, FALSE };
+  GdkFrameClock *clock = gtk_widget_get_frame_clock (widget);
+  gint64 deadline = g_get_monotonic_time () + TIMEOUT_USEC;
+  gulong handler_id;
+
+  g_assert_nonnull (clock);
+
+  handler_id = g_signal_connect (clock, "after-paint",
+                                 G_CALLBACK (after_paint_cb), &data);
+
+  while (!data.done && g_get_monotonic_time () < deadline) {
+    gtk_widget_queue_draw (widget);
+    g_main_context_iteration (NULL, TRUE);
+  }
+
+  g_signal_handler_disconnect (clock, handler_id);
+
+  g_assert_true (data.done);
+
+  return data.node;
+}
+
+static gboolean
+always_ready (GtkWidget *widget)
+{
+  return TRUE;
+}
+
+static gboolean
+album_is_mid_slide (GtkWidget *widget)
+{
+  BisAlbum *album = BIS_ALBUM (widget);
+  GtkWidget *child = bis_album_get_visible_child (album);
+  graphene_rect_t bounds;
+
+  if (!bis_album_get_child_transition_running (album))
+    return FALSE;
+
+  if (!gtk_widget_compute_bounds (child, widget, &bounds))
+    return FALSE;
+
+  return bounds.origin.x > 0 && bounds.origin.x < gtk_widget_get_width (widget);
+}
+
+static gboolean
+lapel_is_hidden (GtkWidget *widget)
+{
+  return bis_lapel_get_reveal_progress (BIS_LAPEL (widget)) == 0;
+}
+
+static gboolean
+lapel_is_half_revealed (GtkWidget *widget)
+{
+  double progress = bis_lapel_get_reveal_progress (BIS_LAPEL (widget));
+
+  return progress > 0 && progress < 1;
+}
+
+static gboolean
+hugger_is_idle (GtkWidget *widget)
+{
+  return !bis_hugger_get_transition_running (BIS_HUGGER (widget));
+}
+
+static gboolean
+hugger_is_crossfading (GtkWidget *widget)
+{
+  return bis_hugger_get_transition_running (BIS_HUGGER (widget));
+}
+
+static void
+test_album_mid_slide (void)
+{
+  GtkWidget *album = bis_album_new ();
+  GtkWidget *page = test_probe_new (200, 200);
+  GtkWidget *window;
+  GskRenderNode *node;
+
+  bis_album_append (BIS_ALBUM (album), test_probe_new (200, 200));
+  bis_album_append (BIS_ALBUM (album), page);
+
+  window = show_in_window (album, 300, 300);
+
+  g_assert_true (bis_album_get_folded (BIS_ALBUM (album)));
+
+  bis_album_set_visible_child (BIS_ALBUM (album), page);
+
+  node = snapshot_when_ready (album, album_is_mid_slide);
+  check_budget ("album-mid-slide", node);
+
+  g_clear_pointer (&node, gsk_render_node_unref);
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
+static void
+test_lapel_half_revealed (void)
+{
+  GtkWidget *lapel = bis_lapel_new ();
+  GtkWidget *window;
+  GskRenderNode *node;
+
+  bis_lapel_set_content (BIS_LAPEL (lapel), test_probe_new (200, 200));
+  bis_lapel_set_lapel (BIS_LAPEL (lapel), test_probe_new (200, 200));
+
+  window = show_in_window (lapel, 300, 300);
+
+  g_assert_true (bis_lapel_get_folded (BIS_LAPEL (lapel)));
+  wait_for (lapel, lapel_is_hidden);
+
+  bis_lapel_set_reveal_lapel (BIS_LAPEL (lapel), TRUE);
+
+  node = snapshot_when_ready (lapel, lapel_is_half_revealed);
+  check_budget ("lapel-half-revealed", node);
+
+  g_clear_pointer (&node, gsk_render_node_unref);
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
+static void
+test_carousel_dots (gconstpointer data)
+{
+  guint n_pages = GPOINTER_TO_UINT (data);
+  GtkWidget *box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 0);
+  GtkWidget *carousel = bis_carousel_new ();
+  GtkWidget *dots = bis_carousel_indicator_dots_new ();
+  GtkWidget *window;
+  GskRenderNode *node;
+  char *scenario;
+  guint i;
+
+  for (i = 0; i < n_pages; i++)
+    bis_carousel_append (BIS_CAROUSEL (carousel), test_probe_new (100, 100));
+
+  bis_carousel_indicator_dots_set_carousel (BIS_CAROUSEL_INDICATOR_DOTS (dots),
+                                            BIS_CAROUSEL (carousel));
+
+  gtk_box_append (GTK_BOX (box), carousel);
+  gtk_box_append (GTK_BOX (box), dots);
+
+  window = show_in_window (box, 300, 300);
+
+  scenario = g_strdup_printf ("carousel-dots-%u", n_pages);
+  node = snapshot_when_ready (dots, always_ready);
+  check_budget (scenario, node);
+
+  g_free (scenario);
+  g_clear_pointer (&node, gsk_render_node_unref);
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
+static void
+test_hugger_crossfade (void)
+{
+  GtkWidget *hugger = bis_hugger_new ();
+  GtkWidget *wide = test_probe_new (400, 200);
+  GtkWidget *window;
+  GskRenderNode *node;
+
+  bis_hugger_set_transition_type (BIS_HUGGER (hugger),
+                                  BIS_HUGGER_TRANSITION_TYPE_CROSSFADE);
+  bis_hugger_add (BIS_HUGGER (hugger), wide);
+  bis_hugger_add (BIS_HUGGER (hugger), test_probe_new (100, 200));
+
+  window = show_in_window (hugger, 300, 300);
+  wait_for (hugger, hugger_is_idle);
+
+  /* Let the first child fit so that the hugger switches back to it */
+  test_probe_set_size (TEST_PROBE (wide), 200, 200);
+
+  node = snapshot_when_ready (hugger, hugger_is_crossfading);
+  check_budget ("hugger-crossfade", node);
+
+  g_clear_pointer (&node, gsk_render_node_unref);
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv, NULL);
+  bis_init ();
+
+  g_test_add_func ("/Bismuth/RenderNodes/album_mid_slide", test_album_mid_slide);
+  g_test_add_func ("/Bismuth/RenderNodes/lapel_half_revealed", test_lapel_half_revealed);
+  g_test_add_data_func ("/Bismuth/RenderNodes/carousel_dots_10",
+                        GUINT_TO_POINTER (10), test_carousel_dots);
+  g_test_add_data_func ("/Bismuth/RenderNodes/carousel_dots_100",
+                        GUINT_TO_POINTER (100), test_carousel_dots);
+  g_test_add_func ("/Bismuth/RenderNodes/hugger_crossfade", test_hugger_crossfade);
+
+  return g_test_run ();
+}